@@ -610,20 +610,6 @@ void VApplication::InitOptions()
     QDir().mkpath(settings->GetDefPathLabelTemplate());
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-QStringList VApplication::LabelLanguages()
-{
-    QStringList list = QStringList() << "de" // German
-                                     << "en" // English
-                                     << "fr" // French
-                                     << "ru" // Russian
-                                     << "uk" // Ukrainian
-                                     << "hr" // Croatian
-                                     << "sr" // Serbian
-                                     << "bs"; // Bosnian
-    return list;
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 void VApplication::StartLogging()
 {
@@ -86,8 +86,6 @@ class VApplication : public VAbstractApplication
     QTimer             *getAutoSaveTimer() const;
     void               setAutoSaveTimer(QTimer *value);
 
-    static QStringList LabelLanguages();
-
     void               StartLogging();
     QTextStream       *LogFile();
 
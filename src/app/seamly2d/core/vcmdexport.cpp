@@ -35,6 +35,7 @@
 #include "../vmisc/vsettings.h"
 #include "../vlayout/vlayoutgenerator.h"
 #include <QDebug>
+#include <QSet>
 
 VCommandLinePtr VCommandLine::instance = nullptr;
 
@@ -130,6 +131,31 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                                               .arg(VMeasurement::WholeListHeights(Unit::Cm).join(", ")),
                                           translate("VCommandLine", "The height value")));
 
+    optionsIndex.insert(LONG_OPTION_GRADATIONSIZES, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_GRADATIONSIZES,
+                                          translate("VCommandLine", "Export the pattern once for each of listed size "
+                                                                    "values (export mode). Combinations of sizes and "
+                                                                    "heights are exported in parallel, one process "
+                                                                    "per combination. Comma separated list of "
+                                                                    "values and ranges, for example '46,50-56', or "
+                                                                    "'all'. Ranges and 'all' select only sizes the "
+                                                                    "pattern file supports. Can be combined with --%1 "
+                                                                    "and --%2, but not with --%3. Each combination "
+                                                                    "gets own files with suffix '_<size>_<height>'.")
+                                                                .arg(LONG_OPTION_GRADATIONHEIGHTS)
+                                                                .arg(LONG_OPTION_GRADATIONHEIGHT)
+                                                                .arg(LONG_OPTION_GRADATIONSIZE),
+                                          translate("VCommandLine", "The size values")));
+
+    optionsIndex.insert(LONG_OPTION_GRADATIONHEIGHTS, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_GRADATIONHEIGHTS,
+                                          translate("VCommandLine", "Export the pattern once for each of listed height "
+                                                                    "values (export mode). Same format as --%1. "
+                                                                    "Can't be combined with --%2.")
+                                                                .arg(LONG_OPTION_GRADATIONSIZES)
+                                                                .arg(LONG_OPTION_GRADATIONHEIGHT),
+                                          translate("VCommandLine", "The height values")));
+
     //=================================================================================================================
     optionsIndex.insert(LONG_OPTION_PAGETEMPLATE, index++);
     options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_PAGETEMPLATE << LONG_OPTION_PAGETEMPLATE,
@@ -258,6 +284,22 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                           .arg(DialogLayoutSettings::MakeGroupsHelp()),
                                           translate("VCommandLine", "Grouping type"), "2"));
 
+    optionsIndex.insert(LONG_OPTION_ATTEMPTS, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_ATTEMPTS,
+                                          translate("VCommandLine", "Number of layouts to try in parallel (export "
+                                                    "mode). Attempts differ by grouping case and rotation step, the "
+                                                    "best layout (fewer sheets, then less used area) wins. Default "
+                                                    "value is 1."),
+                                          translate("VCommandLine", "Attempts count"), "1"));
+
+    optionsIndex.insert(LONG_OPTION_TIMEBUDGET, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TIMEBUDGET,
+                                          translate("VCommandLine", "Time limit for layout generation in seconds "
+                                                    "(export mode). When time is over the program keeps the sheets "
+                                                    "already filled and puts remaining details in rows on next sheets. "
+                                                    "Default value is 0 (no limit)."),
+                                          translate("VCommandLine", "Seconds"), "0"));
+
     optionsIndex.insert(LONG_OPTION_TEST, index++);
     options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_TEST << LONG_OPTION_TEST,
                                           translate("VCommandLine", "Run the program in a test mode. The program in "
@@ -480,6 +522,9 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
     diag.DialogAccepted(); // filling VLayoutGenerator
 
+    res->SetAttempts(OptAttempts());
+    res->SetTimeBudget(OptTimeBudget() * 1000);
+
     return res;
 }
 
@@ -570,6 +615,32 @@ int VCommandLine::OptRotation() const
     return rotate;
 }
 
+//------------------------------------------------------------------------------------------------------
+int VCommandLine::OptAttempts() const
+{
+    bool ok = false;
+    const int attempts = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_ATTEMPTS))).toInt(&ok);
+    if (not ok || attempts < 1)
+    {
+        qCritical() << translate("VCommandLine", "Invalid attempts count. That must be a positive number.") << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+    return attempts;
+}
+
+//------------------------------------------------------------------------------------------------------
+int VCommandLine::OptTimeBudget() const
+{
+    bool ok = false;
+    const int seconds = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TIMEBUDGET))).toInt(&ok);
+    if (not ok || seconds < 0)
+    {
+        qCritical() << translate("VCommandLine", "Invalid time limit. That must be a positive number or 0.") << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+    return seconds;
+}
+
 //------------------------------------------------------------------------------------------------------
 Cases VCommandLine::OptGroup() const
 {
@@ -703,4 +774,181 @@ QString VCommandLine::OptGradationHeight() const
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VCommandLine::IsSetGradationSizes() const
+{
+    const bool r = parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONSIZES)));
+    if (r && parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONSIZE))))
+    {
+        qCritical() << translate("VCommandLine", "Options for single size and list of sizes are conflicting.")
+                    << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+    return r;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VCommandLine::IsSetGradationHeights() const
+{
+    const bool r = parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONHEIGHTS)));
+    if (r && parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONHEIGHT))))
+    {
+        qCritical() << translate("VCommandLine", "Options for single height and list of heights are conflicting.")
+                    << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+    return r;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList VCommandLine::OptGradationSizes(const QStringList &patternSizes) const
+{
+    const QString value = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONSIZES)));
+    if (ParseGradationList(value, VMeasurement::WholeListSizes(Unit::Cm)).isEmpty())
+    {
+        qCritical() << translate("VCommandLine", "Invalid gradation sizes value.") << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+
+    const QStringList sizes = ParseGradationList(value, patternSizes);
+    if (sizes.isEmpty())
+    {
+        qCritical() << translate("VCommandLine", "Gradation sizes '%1' are not supported by this pattern file.")
+                       .arg(value) << "\n";
+    }
+    return sizes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList VCommandLine::OptGradationHeights(const QStringList &patternHeights) const
+{
+    const QString value = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONHEIGHTS)));
+    if (ParseGradationList(value, VMeasurement::WholeListHeights(Unit::Cm)).isEmpty())
+    {
+        qCritical() << translate("VCommandLine", "Invalid gradation heights value.") << "\n";
+        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+    }
+
+    const QStringList heights = ParseGradationList(value, patternHeights);
+    if (heights.isEmpty())
+    {
+        qCritical() << translate("VCommandLine", "Gradation heights '%1' are not supported by this pattern file.")
+                       .arg(value) << "\n";
+    }
+    return heights;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OptCombinationArguments arguments for a child process that exports one combination of batch export.
+ *
+ * Child gets all options of this run except lists of sizes and heights, single size and height and base name are
+ * replaced with values of the combination.
+ * @param size size value in cm, empty string keeps the pattern's size.
+ * @param height height value in cm, empty string keeps the pattern's height.
+ * @param baseName base name of files of the combination.
+ */
+QStringList VCommandLine::OptCombinationArguments(const QString &size, const QString &height,
+                                                  const QString &baseName) const
+{
+    const QStringList replaced = QStringList() << LONG_OPTION_BASENAME
+                                               << LONG_OPTION_GRADATIONSIZE << LONG_OPTION_GRADATIONHEIGHT
+                                               << LONG_OPTION_GRADATIONSIZES << LONG_OPTION_GRADATIONHEIGHTS;
+    QStringList arguments;
+    for (auto i = optionsIndex.constBegin(); i != optionsIndex.constEnd(); ++i)
+    {
+        const QCommandLineOption *option = optionsUsed.value(i.value());
+        if (replaced.contains(i.key()) || not parser.isSet(*option))
+        {
+            continue;
+        }
+
+        const QString name = QLatin1String("--") + i.key();
+        if (option->valueName().isEmpty())
+        {
+            arguments.append(name);
+        }
+        else
+        {
+            const QStringList values = parser.values(*option);
+            for (int j = 0; j < values.size(); ++j)
+            {
+                arguments << name << values.at(j);
+            }
+        }
+    }
+
+    arguments << QLatin1String("--") + LONG_OPTION_BASENAME << baseName;
+    if (not size.isEmpty())
+    {
+        arguments << QLatin1String("--") + LONG_OPTION_GRADATIONSIZE << size;
+    }
+    if (not height.isEmpty())
+    {
+        arguments << QLatin1String("--") + LONG_OPTION_GRADATIONHEIGHT << height;
+    }
+    arguments << parser.positionalArguments();
+    return arguments;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseGradationList convert list of values and ranges to list of valid values.
+ * @param value user input, for example "46,50-56" or "all".
+ * @param validValues all supported values.
+ * @return values in order of valid values, empty list if input is wrong.
+ */
+QStringList VCommandLine::ParseGradationList(const QString &value, const QStringList &validValues)
+{
+    if (value.trimmed() == QLatin1String("all"))
+    {
+        return validValues;
+    }
+
+    QSet<QString> selected;
+    const QStringList parts = value.split(',');
+    for (int i = 0; i < parts.size(); ++i)
+    {
+        const QString part = parts.at(i).trimmed();
+        const int dash = part.indexOf('-', 1);
+        if (dash == -1)
+        {
+            if (not validValues.contains(part))
+            {
+                return QStringList();
+            }
+            selected.insert(part);
+            continue;
+        }
+
+        bool okMin = false;
+        bool okMax = false;
+        const int min = part.left(dash).toInt(&okMin);
+        const int max = part.mid(dash + 1).toInt(&okMax);
+        if (not okMin || not okMax || min > max)
+        {
+            return QStringList();
+        }
+
+        for (int j = 0; j < validValues.size(); ++j)
+        {
+            const int v = validValues.at(j).toInt();
+            if (v >= min && v <= max)
+            {
+                selected.insert(validValues.at(j));
+            }
+        }
+    }
+
+    QStringList values;
+    for (int i = 0; i < validValues.size(); ++i)
+    {
+        if (selected.contains(validValues.at(i)))
+        {
+            values.append(validValues.at(i));
+        }
+    }
+    return values;
+}
+
 #undef translate
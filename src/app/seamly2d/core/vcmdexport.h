@@ -94,6 +94,19 @@ class VCommandLine
     QString OptGradationSize() const;
     QString OptGradationHeight() const;
 
+    bool IsSetGradationSizes() const;
+    bool IsSetGradationHeights() const;
+
+    //@brief returns sizes for batch export in cm, "all" and ranges are resolved against pattern sizes (in cm), empty
+    //list if none of them is supported by the pattern
+    QStringList OptGradationSizes(const QStringList &patternSizes) const;
+    //@brief returns heights for batch export in cm, "all" and ranges are resolved against pattern heights (in cm),
+    //empty list if none of them is supported by the pattern
+    QStringList OptGradationHeights(const QStringList &patternHeights) const;
+
+    //@brief returns arguments of this run for a child process that exports one combination of size and height
+    QStringList OptCombinationArguments(const QString &size, const QString &height, const QString &baseName) const;
+
 protected:
 
     VCommandLine();
@@ -105,6 +118,12 @@ class VCommandLine
 
     Cases OptGroup() const;
 
+    //@brief returns count of parallel layout attempts, 1 if not set
+    int OptAttempts() const;
+
+    //@brief returns layout generation time limit in seconds, 0 if not set
+    int OptTimeBudget() const;
+
     //@brief: called in destructor of application, so instance destroyed and new maybe created (never happen scenario though)
     static void Reset();
 
@@ -122,6 +141,7 @@ class VCommandLine
 
     static qreal Lo2Px(const QString& src, const DialogLayoutSettings& converter);
     static qreal Pg2Px(const QString& src, const DialogLayoutSettings& converter);
+    static QStringList ParseGradationList(const QString &value, const QStringList &validValues);
 
     static void InitOptions(VCommandLineOptions &options, QMap<QString, int> &optionsIndex);
 };
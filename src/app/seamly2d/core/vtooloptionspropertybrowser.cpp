@@ -59,6 +59,7 @@
 #include "../vwidgets/vsimplecurve.h"
 #include "../vpropertyexplorer/vproperties.h"
 #include "vformulaproperty.h"
+#include "../vpatterndb/vcontainer.h"
 #include "../vpatterndb/vformula.h"
 
 #include <QDockWidget>
@@ -67,8 +68,8 @@
 #include <QRegularExpression>
 
 //---------------------------------------------------------------------------------------------------------------------
-VToolOptionsPropertyBrowser::VToolOptionsPropertyBrowser(QDockWidget *parent)
-    :QObject(parent), PropertyModel(nullptr), formView(nullptr), currentItem(nullptr),
+VToolOptionsPropertyBrowser::VToolOptionsPropertyBrowser(const VContainer *data, QDockWidget *parent)
+    :QObject(parent), data(data), PropertyModel(nullptr), formView(nullptr), currentItem(nullptr),
       propertyToId(QMap<VPE::VProperty *, QString>()),
       idToProperty(QMap<QString, VPE::VProperty *>())
 {
@@ -684,7 +685,7 @@ void VToolOptionsPropertyBrowser::SetPointName(const QString &name)
         }
 
         QRegularExpression rx(NameRegExp());
-        if (name.isEmpty() || VContainer::IsUnique(name) == false || rx.match(name).hasMatch() == false)
+        if (name.isEmpty() || data->IsUnique(name) == false || rx.match(name).hasMatch() == false)
         {
             idToProperty[AttrName]->setValue(i->name());
         }
@@ -711,7 +712,7 @@ void VToolOptionsPropertyBrowser::SetPointName1(const QString &name)
         }
 
         QRegularExpression rx(NameRegExp());
-        if (name.isEmpty() || VContainer::IsUnique(name) == false || rx.match(name).hasMatch() == false)
+        if (name.isEmpty() || data->IsUnique(name) == false || rx.match(name).hasMatch() == false)
         {
             idToProperty[AttrName1]->setValue(i->nameP1());
         }
@@ -738,7 +739,7 @@ void VToolOptionsPropertyBrowser::SetPointName2(const QString &name)
         }
 
         QRegularExpression rx(NameRegExp());
-        if (name.isEmpty() || VContainer::IsUnique(name) == false || rx.match(name).hasMatch() == false)
+        if (name.isEmpty() || data->IsUnique(name) == false || rx.match(name).hasMatch() == false)
         {
             idToProperty[AttrName2]->setValue(i->nameP2());
         }
@@ -771,11 +772,11 @@ void VToolOptionsPropertyBrowser::SetOperationSuffix(const QString &suffix)
         }
 
         QRegularExpression rx(NameRegExp());
-        const QStringList uniqueNames = VContainer::AllUniqueNames();
+        const QStringList uniqueNames = data->AllUniqueNames();
         for (int i=0; i < uniqueNames.size(); ++i)
         {
             const QString name = uniqueNames.at(i) + suffix;
-            if (not rx.match(name).hasMatch() || not VContainer::IsUnique(name))
+            if (not rx.match(name).hasMatch() || not data->IsUnique(name))
             {
                 idToProperty[AttrSuffix]->setValue(item->Suffix());
                 return;
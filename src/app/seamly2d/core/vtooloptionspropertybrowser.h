@@ -62,13 +62,14 @@
 class QDockWidget;
 class QGraphicsItem;
 class QScrollArea;
+class VContainer;
 class VFormula;
 
 class VToolOptionsPropertyBrowser : public QObject
 {
     Q_OBJECT
 public:
-    explicit VToolOptionsPropertyBrowser(QDockWidget *parent);
+    VToolOptionsPropertyBrowser(const VContainer *data, QDockWidget *parent);
     void ClearPropertyBrowser();
 public slots:
     void itemClicked(QGraphicsItem *item);
@@ -79,6 +80,8 @@ private slots:
 private:
     Q_DISABLE_COPY(VToolOptionsPropertyBrowser)
 
+    const VContainer *data;
+
     VPE::VPropertyModel* PropertyModel;
     VPE::VPropertyFormView* formView;
 
@@ -84,6 +84,13 @@ PreferencesConfigurationPage::PreferencesConfigurationPage(QWidget *parent)
     // Warnings
     ui->confirmItemDelete_CheckBox->setChecked(qApp->Seamly2DSettings()->getConfirmItemDelete());
     ui->confirmFormatRewriting_CheckBox->setChecked(qApp->Seamly2DSettings()->getConfirmFormatRewriting());
+
+    // Recalculation
+    ui->incrementalParse_CheckBox->setChecked(qApp->Seamly2DSettings()->IsIncrementalParse());
+    ui->verifyIncrementalParse_CheckBox->setChecked(qApp->Seamly2DSettings()->IsVerifyIncrementalParse());
+    ui->verifyIncrementalParse_CheckBox->setEnabled(ui->incrementalParse_CheckBox->isChecked());
+    connect(ui->incrementalParse_CheckBox, &QCheckBox::toggled, ui->verifyIncrementalParse_CheckBox,
+            &QCheckBox::setEnabled);
     // Send crash reports
     //ui->sendReportCheck->setChecked(qApp->Seamly2DSettings()->GetSendReportState());
     //ui->description = new QLabel(tr("After each crash Seamly2D collects information that may help us fix the "
@@ -199,7 +206,7 @@ PreferencesConfigurationPage::PreferencesConfigurationPage(QWidget *parent)
     {
         m_unitChanged = true;
     });
-    SetLabelComboBox(VApplication::LabelLanguages());
+    SetLabelComboBox(VSettings::LabelLanguages());
 
     index = ui->labelCombo->findData(qApp->Seamly2DSettings()->GetLabelLanguage());
     if (index != -1)
@@ -228,6 +235,8 @@ void PreferencesConfigurationPage::Apply()
     settings->SetUndoCount(ui->undoCount_SpinBox->value());
     settings->setConfirmItemDelete(ui->confirmItemDelete_CheckBox->isChecked());
     settings->setConfirmFormatRewriting(ui->confirmFormatRewriting_CheckBox->isChecked());
+    settings->SetIncrementalParse(ui->incrementalParse_CheckBox->isChecked());
+    settings->SetVerifyIncrementalParse(ui->verifyIncrementalParse_CheckBox->isChecked());
 
     settings->SetAutosaveState(ui->autoSave_CheckBox->isChecked());
     settings->setAutosaveInterval(ui->autoInterval_Spinbox->value());
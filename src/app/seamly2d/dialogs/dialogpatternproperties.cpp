@@ -661,7 +661,7 @@ void DialogPatternProperties::SetDefaultHeight(const QString &def)
     }
     else
     {
-        const int height = static_cast<int>(VContainer::height());
+        const int height = static_cast<int>(pattern->height());
         index = ui->comboBoxHeight->findText(QString().setNum(height));
         if (index != -1)
         {
@@ -682,7 +682,7 @@ void DialogPatternProperties::SetDefaultSize(const QString &def)
     }
     else
     {
-        const int size = static_cast<int>(VContainer::size());
+        const int size = static_cast<int>(pattern->size());
         index = ui->comboBoxSize->findText(QString().setNum(size));
         if (index != -1)
         {
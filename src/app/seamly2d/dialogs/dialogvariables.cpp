@@ -57,6 +57,7 @@
 #include "../qmuparser/qmutokenparser.h"
 #include "../vpatterndb/vtranslatevars.h"
 #include "../vpatterndb/calculator.h"
+#include "../vpatterndb/variables/vmeasurement.h"
 #include "../vtools/dialogs/support/dialogeditwrongformula.h"
 
 #include <QFileDialog>
@@ -124,6 +125,7 @@ DialogVariables::DialogVariables(VContainer *data, VPattern *doc, QWidget *paren
     tableList.append(QSharedPointer<QTableWidget>(ui->arcRadiuses_TableWidget));
 
     connect(this->doc, &VPattern::FullUpdateFromFile, this, &DialogVariables::FullUpdateFromFile);
+    connect(this->doc, &VPattern::PartialUpdateFromFile, this, &DialogVariables::FullUpdateFromFile);
 
     ui->tabWidget->setCurrentIndex(0);
     ui->name_LineEdit->setValidator( new QRegularExpressionValidator(QRegularExpression(
@@ -416,7 +418,7 @@ bool DialogVariables::evalVariableFormula(const QString &formula, bool fromUser,
             }
 
             label->setText(qApp->LocaleToString(result) + " " + postfix);
-            label->setToolTip(tr("Value"));
+            label->setToolTip(tr("Value") + gradationValues(f, data));
             return true;
         }
         catch (qmu::QmuParserError &e)
@@ -428,6 +430,46 @@ bool DialogVariables::evalVariableFormula(const QString &formula, bool fromUser,
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief gradationValues list values of formula for each size of the pattern gradation at the current height.
+ * @return lines for the tooltip, empty if pattern is not multisize or formula depends on pattern geometry.
+ */
+QString DialogVariables::gradationValues(const QString &formula, const VContainer *data) const
+{
+    if (qApp->patternType() != MeasurementsType::Multisize)
+    {
+        return QString();
+    }
+
+    const QStringList list = VMeasurement::ListSizes(doc->GetGradationSizes(), qApp->patternUnit());
+
+    QVector<qreal> sizes;
+    QVector<qreal> heights;
+    for (int i = 0; i < list.size(); ++i)
+    {
+        sizes.append(list.at(i).toDouble());
+        heights.append(data->height());
+    }
+
+    try
+    {
+        const QVector<qreal> values = Calculator().EvalFormula(data->DataVariables(), formula, sizes, heights);
+
+        QString text;
+        for (int i = 0; i < values.size(); ++i)
+        {
+            text += "\n" + tr("Size %1: %2").arg(list.at(i)).arg(qApp->LocaleToString(values.at(i)));
+        }
+        return text;
+    }
+    catch (qmu::QmuParserError &e)
+    {
+        Q_UNUSED(e)
+        return QString();
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void DialogVariables::setMoveControls()
 {
@@ -145,6 +145,7 @@ private slots:
 
     bool                             evalVariableFormula(const QString &formula, bool fromUser,
                                                           VContainer *data, QLabel *label);
+    QString                          gradationValues(const QString &formula, const VContainer *data) const;
     void                             setMoveControls();
     void                             enableDetails(bool enabled);
 
@@ -97,6 +97,9 @@
 #include <QUndoStack>
 #include <QAction>
 #include <QProcess>
+#include <QEventLoop>
+#include <QSignalBlocker>
+#include <QThread>
 #include <QSettings>
 #include <QTimer>
 #include <QtGlobal>
@@ -432,8 +435,8 @@ QSharedPointer<VMeasurements> MainWindow::OpenMeasurementFile(const QString &pat
     try
     {
         measurements = QSharedPointer<VMeasurements>(new VMeasurements(pattern));
-        measurements->SetSize(VContainer::rsize());
-        measurements->SetHeight(VContainer::rheight());
+        measurements->SetSize(pattern->rsize());
+        measurements->SetHeight(pattern->rheight());
         measurements->setXMLContent(path);
 
         if (measurements->Type() == MeasurementsType::Unknown)
@@ -526,9 +529,9 @@ bool MainWindow::LoadMeasurements(const QString &path)
 
     if (measurements->Type() == MeasurementsType::Multisize)
     {
-        VContainer::SetSize(UnitConvertor(measurements->BaseSize(), measurements->MUnit(),
+        pattern->SetSize(UnitConvertor(measurements->BaseSize(), measurements->MUnit(),
                                           *measurements->GetData()->GetPatternUnit()));
-        VContainer::SetHeight(UnitConvertor(measurements->BaseHeight(), measurements->MUnit(),
+        pattern->SetHeight(UnitConvertor(measurements->BaseHeight(), measurements->MUnit(),
                                             *measurements->GetData()->GetPatternUnit()));
 
         doc->SetPatternWasChanged(true);
@@ -580,8 +583,8 @@ bool MainWindow::UpdateMeasurements(const QString &path, int size, int height)
 
     if (measurements->Type() == MeasurementsType::Multisize)
     {
-        VContainer::SetSize(size);
-        VContainer::SetHeight(height);
+        pattern->SetSize(size);
+        pattern->SetHeight(height);
 
         doc->SetPatternWasChanged(true);
         emit doc->UpdatePatternLabel();
@@ -1384,7 +1387,7 @@ void MainWindow::ClosedDialogGroup(int result)
     {
         QSharedPointer<DialogGroup> dialog = dialogTool.objectCast<DialogGroup>();
         SCASSERT(dialog != nullptr)
-        const QDomElement group = doc->CreateGroup(VContainer::getNextId(), dialog->GetName(), dialog->GetGroup());
+        const QDomElement group = doc->CreateGroup(pattern->getNextId(), dialog->GetName(), dialog->GetGroup());
         if (not group.isNull())
         {
             AddGroup *addGroup = new AddGroup(group, doc);
@@ -1943,9 +1946,9 @@ void MainWindow::ShowMeasurements()
                     << "-u"
                     << UnitsToStr(qApp->patternUnit())
                     << "-e"
-                    << QString().setNum(static_cast<int>(UnitConvertor(VContainer::height(), doc->MUnit(), Unit::Cm)))
+                    << QString().setNum(static_cast<int>(UnitConvertor(pattern->height(), doc->MUnit(), Unit::Cm)))
                     << "-s"
-                    << QString().setNum(static_cast<int>(UnitConvertor(VContainer::size(), doc->MUnit(), Unit::Cm)));
+                    << QString().setNum(static_cast<int>(UnitConvertor(pattern->size(), doc->MUnit(), Unit::Cm)));
         }
         else
         {
@@ -2006,7 +2009,7 @@ void MainWindow::SyncMeasurements()
     if (mChanges)
     {
         const QString path = AbsoluteMPath(qApp->GetPPath(), doc->MPath());
-        if(UpdateMeasurements(path, static_cast<int>(VContainer::size()), static_cast<int>(VContainer::height())))
+        if(UpdateMeasurements(path, static_cast<int>(pattern->size()), static_cast<int>(pattern->height())))
         {
             if (not watcher->files().contains(path))
             {
@@ -3791,6 +3794,7 @@ void MainWindow::Clear()
         watcher->removePath(AbsoluteMPath(qApp->GetPPath(), doc->MPath()));
     }
     doc->clear();
+    doc->RefreshElementIdCache();
     qCDebug(vMainWindow, "Clearing scenes.");
     draftScene->clear();
     pieceScene->clear();
@@ -4246,6 +4250,27 @@ void MainWindow::PatternChangesWereSaved(bool saved)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ChangeGradation change current size and height without reading measurements file again.
+ *
+ * Multisize measurements calculate their values from current size and height of the pattern, so it is enough to update
+ * them and recalculate the pattern.
+ * @param size new size value.
+ * @param height new height value.
+ */
+void MainWindow::ChangeGradation(int size, int height)
+{
+    pattern->SetSize(size);
+    pattern->SetHeight(height);
+
+    doc->SetPatternWasChanged(true);
+    emit doc->UpdatePatternLabel();
+
+    doc->LiteParseTree(Document::LiteParse);
+    emit pieceScene->DimensionsChanged();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief ChangedSize change new size value.
@@ -4253,10 +4278,16 @@ void MainWindow::PatternChangesWereSaved(bool saved)
  */
 void MainWindow::ChangedSize(int index)
 {
-    const int size = static_cast<int>(VContainer::size());
+    if (qApp->patternType() == MeasurementsType::Multisize)
+    {
+        ChangeGradation(gradationSizes.data()->itemText(index).toInt(), static_cast<int>(pattern->height()));
+        return;
+    }
+
+    const int size = static_cast<int>(pattern->size());
     if (UpdateMeasurements(AbsoluteMPath(qApp->GetPPath(), doc->MPath()),
                            gradationSizes.data()->itemText(index).toInt(),
-                           static_cast<int>(VContainer::height())))
+                           static_cast<int>(pattern->height())))
     {
         doc->LiteParseTree(Document::LiteParse);
         emit pieceScene->DimensionsChanged();
@@ -4284,8 +4315,14 @@ void MainWindow::ChangedSize(int index)
  */
 void MainWindow::ChangedHeight(int index)
 {
-    const int height = static_cast<int>(VContainer::height());
-    if (UpdateMeasurements(AbsoluteMPath(qApp->GetPPath(), doc->MPath()), static_cast<int>(VContainer::size()),
+    if (qApp->patternType() == MeasurementsType::Multisize)
+    {
+        ChangeGradation(static_cast<int>(pattern->size()), gradationHeights.data()->itemText(index).toInt());
+        return;
+    }
+
+    const int height = static_cast<int>(pattern->height());
+    if (UpdateMeasurements(AbsoluteMPath(qApp->GetPPath(), doc->MPath()), static_cast<int>(pattern->size()),
                            gradationHeights.data()->itemText(index).toInt()))
     {
         doc->LiteParseTree(Document::LiteParse);
@@ -4318,13 +4355,13 @@ void MainWindow::SetDefaultHeight()
     }
     else
     {
-        index = gradationHeights->findText(QString().setNum(VContainer::height()));
+        index = gradationHeights->findText(QString().setNum(pattern->height()));
         if (index != -1)
         {
             gradationHeights->setCurrentIndex(index);
         }
     }
-    VContainer::SetHeight(gradationHeights->currentText().toInt());
+    pattern->SetHeight(gradationHeights->currentText().toInt());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -4338,13 +4375,13 @@ void MainWindow::SetDefaultSize()
     }
     else
     {
-        index = gradationSizes->findText(QString().setNum(VContainer::size()));
+        index = gradationSizes->findText(QString().setNum(pattern->size()));
         if (index != -1)
         {
             gradationSizes->setCurrentIndex(index);
         }
     }
-    VContainer::SetSize(gradationSizes->currentText().toInt());
+    pattern->SetSize(gradationSizes->currentText().toInt());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -5085,10 +5122,11 @@ void MainWindow::AddDocks()
 void MainWindow::InitDocksContain()
 {
     qCDebug(vMainWindow, "Initialize Tool Options Property editor.");
-    toolProperties = new VToolOptionsPropertyBrowser(ui->toolProperties_DockWidget);
+    toolProperties = new VToolOptionsPropertyBrowser(pattern, ui->toolProperties_DockWidget);
 
     connect(ui->view, &VMainGraphicsView::itemClicked, toolProperties, &VToolOptionsPropertyBrowser::itemClicked);
     connect(doc, &VPattern::FullUpdateFromFile, toolProperties, &VToolOptionsPropertyBrowser::UpdateOptions);
+    connect(doc, &VPattern::PartialUpdateFromFile, toolProperties, &VToolOptionsPropertyBrowser::UpdateOptions);
 
     qCDebug(vMainWindow, "Initialize Groups manager.");
     groupsWidget = new VWidgetGroups(doc, this);
@@ -5096,6 +5134,7 @@ void MainWindow::InitDocksContain()
 
     patternPiecesWidget = new VWidgetDetails(pattern, doc, this);
     connect(doc, &VPattern::FullUpdateFromFile, patternPiecesWidget, &VWidgetDetails::UpdateList);
+    connect(doc, &VPattern::PartialUpdateFromFile, patternPiecesWidget, &VWidgetDetails::UpdateList);
     connect(doc, &VPattern::UpdateInLayoutList, patternPiecesWidget, &VWidgetDetails::UpdateList);
     connect(doc, &VPattern::ShowDetail, patternPiecesWidget, &VWidgetDetails::SelectDetail);
     connect(patternPiecesWidget, &VWidgetDetails::Highlight, pieceScene, &VMainGraphicsScene::HighlightItem);
@@ -5827,8 +5866,8 @@ bool MainWindow::LoadPattern(const QString &fileName, const QString& customMeasu
         // Here comes undocumented Seamly2D's feature.
         // Because app bundle in Mac OS X doesn't allow setup association for SeamlyMe we must do this through Seamly2D
         VMeasurements measurements(pattern);
-        measurements.SetSize(VContainer::rsize());
-        measurements.SetHeight(VContainer::rheight());
+        measurements.SetSize(pattern->rsize());
+        measurements.SetHeight(pattern->rheight());
         measurements.setXMLContent(fileName);
 
         if (measurements.Type() == MeasurementsType::Multisize || measurements.Type() == MeasurementsType::Individual)
@@ -6505,8 +6544,8 @@ QString MainWindow::CheckPathToMeasurements(const QString &patternPath, const QS
                 else
                 {
                     QScopedPointer<VMeasurements> measurements(new VMeasurements(pattern));
-                    measurements->SetSize(VContainer::rsize());
-                    measurements->SetHeight(VContainer::rheight());
+                    measurements->SetSize(pattern->rsize());
+                    measurements->SetHeight(pattern->rheight());
                     measurements->setXMLContent(mPath);
 
                     patternType = measurements->Type();
@@ -6613,7 +6652,7 @@ void MainWindow::zoomFirstShow()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void MainWindow::DoExport(const VCommandLinePtr &expParams)
+bool MainWindow::DoExport(const VCommandLinePtr &expParams)
 {
     const QHash<quint32, VPiece> *details = pattern->DataPieces();
     if(not qApp->getOpeningPattern())
@@ -6622,7 +6661,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         {
             qCCritical(vMainWindow, "%s", qUtf8Printable(tr("You can't export empty scene.")));
             qApp->exit(V_EX_DATAERR);
-            return;
+            return false;
         }
     }
     listDetails = PrepareDetailsForLayout(*details);
@@ -6644,7 +6683,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         {
             qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export error.")), qUtf8Printable(e.ErrorMessage()));
             qApp->exit(V_EX_DATAERR);
-            return;
+            return false;
         }
     }
     else
@@ -6667,16 +6706,134 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
             {
                 qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export error.")), qUtf8Printable(e.ErrorMessage()));
                 qApp->exit(V_EX_DATAERR);
-                return;
+                return false;
             }
         }
         else
         {
-            return;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DoBatchExport export the pattern for each combination of sizes and heights from command line.
+ *
+ * Each combination is exported by own child process, so combinations run in parallel, no more processes than cores.
+ * Files of each combination get suffix "_<size>_<height>". "all" and ranges select only values the pattern's
+ * gradation supports. Export stops starting new combinations after the first failed one.
+ */
+bool MainWindow::DoBatchExport(const VCommandLinePtr &expParams)
+{
+    QStringList sizes;
+    if (expParams->IsSetGradationSizes())
+    {
+        sizes = expParams->OptGradationSizes(VMeasurement::ListSizes(doc->GetGradationSizes(), Unit::Cm));
+        if (sizes.isEmpty())
+        {
+            qApp->exit(V_EX_DATAERR);
+            return false;
+        }
+    }
+    else
+    {
+        sizes.append(expParams->IsSetGradationSize() ? expParams->OptGradationSize() : QString());
+    }
+
+    QStringList heights;
+    if (expParams->IsSetGradationHeights())
+    {
+        heights = expParams->OptGradationHeights(VMeasurement::ListHeights(doc->GetGradationHeights(), Unit::Cm));
+        if (heights.isEmpty())
+        {
+            qApp->exit(V_EX_DATAERR);
+            return false;
+        }
+    }
+    else
+    {
+        heights.append(expParams->IsSetGradationHeight() ? expParams->OptGradationHeight() : QString());
+    }
+
+    // Empty value keeps the pattern's own size or height
+    const QString patternSize =
+            QString().setNum(static_cast<int>(UnitConvertor(pattern->size(), *pattern->GetPatternUnit(), Unit::Cm)));
+    const QString patternHeight =
+            QString().setNum(static_cast<int>(UnitConvertor(pattern->height(), *pattern->GetPatternUnit(), Unit::Cm)));
+
+    QVector<QStringList> combinations;
+    for (int i = 0; i < heights.size(); ++i)
+    {
+        for (int j = 0; j < sizes.size(); ++j)
+        {
+            const QString baseName = expParams->OptBaseName() + QString("_%1_%2")
+                    .arg(sizes.at(j).isEmpty() ? patternSize : sizes.at(j))
+                    .arg(heights.at(i).isEmpty() ? patternHeight : heights.at(i));
+            combinations.append(expParams->OptCombinationArguments(sizes.at(j), heights.at(i), baseName));
         }
     }
 
-    qApp->exit(V_EX_OK);
+    const int maxProcesses = qMax(1, QThread::idealThreadCount());
+    QList<QProcess *> processes;
+    QEventLoop loop;
+    int exitCode = V_EX_OK;
+    int next = 0;
+    while (not processes.isEmpty() || (next < combinations.size() && exitCode == V_EX_OK))
+    {
+        while (processes.size() < maxProcesses && next < combinations.size() && exitCode == V_EX_OK)
+        {
+            QProcess *process = new QProcess();
+            process->setProcessChannelMode(QProcess::ForwardedChannels);
+            connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), &loop, &QEventLoop::quit);
+            qCDebug(vMainWindow, "Batch export %s.", qUtf8Printable(combinations.at(next).join(QChar(' '))));
+            process->start(QCoreApplication::applicationFilePath(), combinations.at(next++));
+            if (process->waitForStarted())
+            {
+                processes.append(process);
+            }
+            else
+            {
+                qCCritical(vMainWindow, "%s", qUtf8Printable(tr("Couldn't start export process: %1")
+                                                             .arg(process->errorString())));
+                exitCode = V_EX_SOFTWARE;
+                delete process;
+            }
+        }
+
+        if (processes.isEmpty())
+        {
+            break;
+        }
+
+        loop.exec();
+
+        for (int i = processes.size() - 1; i >= 0; --i)
+        {
+            QProcess *process = processes.at(i);
+            if (process->state() != QProcess::NotRunning)
+            {
+                continue;
+            }
+
+            const bool crashed = process->exitStatus() != QProcess::NormalExit;
+            if (exitCode == V_EX_OK && (crashed || process->exitCode() != V_EX_OK))
+            {
+                exitCode = crashed ? V_EX_SOFTWARE : process->exitCode();
+            }
+            processes.removeAt(i);
+            delete process;
+        }
+    }
+
+    if (exitCode != V_EX_OK)
+    {
+        qApp->exit(exitCode);
+        return false;
+    }
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -6692,6 +6849,8 @@ bool MainWindow::SetSize(const QString &text)
                 const qint32 index = gradationSizes->findText(QString().setNum(size));
                 if (index != -1)
                 {
+                    // Pattern is recalculated once for both size and height, see ProcessCMD()
+                    const QSignalBlocker blocker(gradationSizes);
                     gradationSizes->setCurrentIndex(index);
                 }
                 else
@@ -6735,6 +6894,8 @@ bool MainWindow::SetHeight(const QString &text)
                 const qint32 index = gradationHeights->findText(QString().setNum(height));
                 if (index != -1)
                 {
+                    // Pattern is recalculated once for both size and height, see ProcessCMD()
+                    const QSignalBlocker blocker(gradationHeights);
                     gradationHeights->setCurrentIndex(index);
                 }
                 else
@@ -6796,6 +6957,8 @@ void MainWindow::ProcessCMD()
             return; // process only one input file
         }
 
+        const bool batch = cmd->IsExportEnabled()
+                && (cmd->IsSetGradationSizes() || cmd->IsSetGradationHeights());
         bool hSetted = true;
         bool sSetted = true;
         if (loaded && (cmd->IsTestModeEnabled() || cmd->IsExportEnabled()))
@@ -6809,6 +6972,12 @@ void MainWindow::ProcessCMD()
             {
                 hSetted = SetHeight(cmd->OptGradationHeight());
             }
+
+            // Batch export recalculates the pattern in child processes
+            if ((cmd->IsSetGradationSize() || cmd->IsSetGradationHeight()) && sSetted && hSetted && not batch)
+            {
+                ChangeGradation(gradationSizes->currentText().toInt(), gradationHeights->currentText().toInt());
+            }
         }
 
         if (not cmd->IsTestModeEnabled())
@@ -6817,7 +6986,10 @@ void MainWindow::ProcessCMD()
             {
                 if (loaded && hSetted && sSetted)
                 {
-                    DoExport(cmd);
+                    if (batch ? DoBatchExport(cmd) : DoExport(cmd))
+                    {
+                        qApp->exit(V_EX_OK);
+                    }
                     return; // process only one input file
                 }
                 else
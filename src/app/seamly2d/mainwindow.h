@@ -420,10 +420,12 @@ private slots:
     QSharedPointer<VMeasurements> OpenMeasurementFile(const QString &path);
     bool               LoadMeasurements(const QString &path);
     bool               UpdateMeasurements(const QString &path, int size, int height);
+    void               ChangeGradation(int size, int height);
     void               CheckRequiredMeasurements(const VMeasurements *m);
 
     void               ReopenFilesAfterCrash(QStringList &args);
-    void               DoExport(const VCommandLinePtr& expParams);
+    bool               DoExport(const VCommandLinePtr& expParams);
+    bool               DoBatchExport(const VCommandLinePtr& expParams);
 
     bool               SetSize(const QString &text);
     bool               SetHeight(const QString & text);
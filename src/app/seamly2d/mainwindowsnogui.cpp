@@ -210,6 +210,11 @@ bool MainWindowsNoGUI::LayoutSettings(VLayoutGenerator& lGenerator)
             isAutoCrop = lGenerator.GetAutoCrop();
             isUnitePages = lGenerator.IsUnitePages();
             isLayoutStale = false;
+            if (lGenerator.IsTimedOut())
+            {
+                qWarning() << tr("Layout time limit is over. Pattern pieces left were placed in rows without "
+                                 "optimization.");
+            }
             if (VApplication::IsGUIMode())
             {
                 QApplication::alert(this);
@@ -709,7 +714,7 @@ void MainWindowsNoGUI::RefreshDetailsLabel()
     QHash<quint32, VPiece>::const_iterator i = list->constBegin();
     while (i != list->constEnd())
     {
-        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(i.key())))
+        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(doc->getTool(i.key())))
         {
             tool->UpdatePatternInfo();
             tool->UpdateDetailLabel();
@@ -728,7 +733,7 @@ void MainWindowsNoGUI::refreshGrainLines()
     QHash<quint32, VPiece>::const_iterator i = list->constBegin();
     while (i != list->constEnd())
     {
-        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(i.key())))
+        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(doc->getTool(i.key())))
         {
             tool->UpdateGrainline();
         }
@@ -746,7 +751,7 @@ void MainWindowsNoGUI::refreshSeamAllowances()
     QHash<quint32, VPiece>::const_iterator i = list->constBegin();
     while (i != list->constEnd())
     {
-        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(i.key())))
+        if (VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(doc->getTool(i.key())))
         {
             tool->RefreshGeometry();
         }
@@ -755,7 +760,7 @@ void MainWindowsNoGUI::refreshSeamAllowances()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QVector<VLayoutPiece> MainWindowsNoGUI::PrepareDetailsForLayout(const QHash<quint32, VPiece> &details)
+QVector<VLayoutPiece> MainWindowsNoGUI::PrepareDetailsForLayout(const QHash<quint32, VPiece> &details) const
 {
     QVector<VLayoutPiece> listDetails;
     if (not details.isEmpty())
@@ -763,7 +768,7 @@ QVector<VLayoutPiece> MainWindowsNoGUI::PrepareDetailsForLayout(const QHash<quin
         QHash<quint32, VPiece>::const_iterator i = details.constBegin();
         while (i != details.constEnd())
         {
-            VAbstractTool *tool = qobject_cast<VAbstractTool*>(VAbstractPattern::getTool(i.key()));
+            VAbstractTool *tool = qobject_cast<VAbstractTool*>(doc->getTool(i.key()));
             SCASSERT(tool != nullptr)
             listDetails.append(VLayoutPiece::Create(i.value(), tool->getData()));
             ++i;
@@ -1713,20 +1718,20 @@ void MainWindowsNoGUI::SetSizeHeightForIndividualM() const
 
     if (vars->contains(size_M))
     {
-        VContainer::SetSize(*vars->value(size_M)->GetValue());
+        pattern->SetSize(*vars->value(size_M)->GetValue());
     }
     else
     {
-        VContainer::SetSize(0);
+        pattern->SetSize(0);
     }
 
     if (vars->contains(height_M))
     {
-        VContainer::SetHeight(*vars->value(height_M)->GetValue());
+        pattern->SetHeight(*vars->value(height_M)->GetValue());
     }
     else
     {
-        VContainer::SetHeight(0);
+        pattern->SetHeight(0);
     }
 
     doc->SetPatternWasChanged(true);
@@ -129,7 +129,7 @@ public slots:
     QMarginsF margins;
     QSizeF paperSize;
 
-    static QVector<VLayoutPiece> PrepareDetailsForLayout(const QHash<quint32, VPiece> &details);
+    QVector<VLayoutPiece> PrepareDetailsForLayout(const QHash<quint32, VPiece> &details) const;
 
     void ExportData(const QVector<VLayoutPiece> &listDetails, const DialogSaveLayout &dialog);
 
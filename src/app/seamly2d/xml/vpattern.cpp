@@ -51,6 +51,8 @@
 
 #include "vpattern.h"
 #include "../vwidgets/vabstractmainwindow.h"
+#include "../vwidgets/vmaingraphicsscene.h"
+#include "../vwidgets/vmaingraphicsview.h"
 #include "../vtools/tools/vdatatool.h"
 #include "../vtools/tools/vtoolseamallowance.h"
 #include "../vtools/tools/vtooluniondetails.h"
@@ -67,6 +69,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/projectversion.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vsysexits.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../qmuparser/qmutokenparser.h"
 #include "../vgeometry/varc.h"
@@ -74,7 +77,6 @@
 #include "../vgeometry/vsplinepath.h"
 #include "../vgeometry/vcubicbezier.h"
 #include "../vgeometry/vcubicbezierpath.h"
-#include "../core/vapplication.h"
 #include "../vpatterndb/vpiecenode.h"
 #include "../vpatterndb/calculator.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
@@ -82,12 +84,16 @@
 #include "../vpatterndb/floatItemData/vgrainlinedata.h"
 #include "../vpatterndb/vpiecepath.h"
 #include "../vpatterndb/vnodedetail.h"
+#include "../vpatterndb/variables/vcurvevariable.h"
+#include "../vpatterndb/variables/vlineangle.h"
+#include "../vpatterndb/variables/vlinelength.h"
 
 #include <QMessageBox>
 #include <QUndoStack>
 #include <QtNumeric>
 #include <QDebug>
 #include <QFileInfo>
+#include <algorithm>
 
 const QString VPattern::AttrReadOnly = QStringLiteral("readOnly");
 
@@ -98,6 +104,148 @@ QString FileComment()
 {
     return QString("Pattern created with Seamly2D v%1 (https://seamly.net).").arg(APP_VERSION_STR);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+// Document needs only the abstract application, so it can be tested without the main window.
+VSettings *Seamly2DSettings()
+{
+    VSettings *settings = qobject_cast<VSettings *>(qApp->Settings());
+    SCASSERT(settings != nullptr)
+    return settings;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Attributes that hold ids of objects. Coordinates, options and formulas are not references even if they look like
+// numbers.
+bool IsReferenceAttribute(const QString &name)
+{
+    static const QSet<QString> attributes = QSet<QString>()
+            << AttrBasePoint << AttrFirstPoint << AttrSecondPoint << AttrThirdPoint << AttrCenter
+            << AttrP1Line << AttrP2Line << AttrP1Line1 << AttrP2Line1 << AttrP1Line2 << AttrP2Line2
+            << AttrPShoulder << AttrPoint1 << AttrPoint2 << AttrPoint3 << AttrPoint4 << AttrPSpline
+            << AttrAxisP1 << AttrAxisP2 << AttrCurve << AttrCurve1 << AttrCurve2 << AttrFirstArc << AttrSecondArc
+            << AttrC1Center << AttrC2Center << AttrCCenter << AttrTangent << AttrArc << AttrIdObject
+            << AttrBaseLineP1 << AttrBaseLineP2 << AttrDartP1 << AttrDartP2 << AttrDartP3
+            << VToolCutSpline::AttrSpline << VToolCutSplinePath::AttrSplinePath << VAbstractNode::AttrIdTool
+            << VToolUnionDetails::AttrIndexD1 << VToolUnionDetails::AttrIndexD2
+            << VAbstractPattern::AttrStart << VAbstractPattern::AttrPath << VAbstractPattern::AttrEnd
+            << VToolSeamAllowance::AttrTopLeftPin << VToolSeamAllowance::AttrBottomRightPin
+            << VToolSeamAllowance::AttrCenterPin << VToolSeamAllowance::AttrTopPin
+            << VToolSeamAllowance::AttrBottomPin;
+    return attributes.contains(name);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void CollectReference(const QString &value, QSet<quint32> *references)
+{
+    bool ok = false;
+    const quint32 id = value.toUInt(&ok);
+    if (ok && references != nullptr)
+    {
+        references->insert(id);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Words of a formula can be names of variables. Extra candidates do no harm, they are just not found.
+void CollectTokens(const QString &value, QSet<QString> *tokens)
+{
+    bool ok = false;
+    value.toDouble(&ok);
+    if (ok || tokens == nullptr)
+    {
+        return;
+    }
+
+    const QString separators = QStringLiteral("+-*/^()<>=!?:;,&|%");
+    int start = 0;
+    for (int i = 0; i <= value.size(); ++i)
+    {
+        if (i == value.size() || value.at(i).isSpace() || separators.contains(value.at(i)))
+        {
+            if (i > start)
+            {
+                tokens->insert(value.mid(start, i - start));
+            }
+            start = i + 1;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ScanElement(const QDomElement &domElement, QString &text, QSet<quint32> *references, QSet<QString> *tokens)
+{
+    QStringList attributes;
+    const QDomNamedNodeMap map = domElement.attributes();
+    for (int i = 0; i < map.count(); ++i)
+    {
+        const QDomAttr attribute = map.item(i).toAttr();
+        attributes.append(attribute.name() + QLatin1Char('=') + attribute.value());
+        if (IsReferenceAttribute(attribute.name()))
+        {
+            CollectReference(attribute.value(), references);
+        }
+        else
+        {
+            CollectTokens(attribute.value(), tokens);
+        }
+    }
+    // Order of attributes in a tag is not defined
+    attributes.sort();
+    text += QLatin1Char('<') + domElement.tagName() + QLatin1Char(' ') + attributes.join(QLatin1Char(' '))
+            + QLatin1Char('>');
+
+    QDomNode domNode = domElement.firstChild();
+    while (not domNode.isNull())
+    {
+        if (domNode.isElement())
+        {
+            ScanElement(domNode.toElement(), text, references, tokens);
+        }
+        else if (domNode.isText())
+        {
+            text += domNode.nodeValue();
+            // Pins of a piece are stored as ids in records
+            if (domElement.tagName() == VToolSeamAllowance::TagRecord)
+            {
+                CollectReference(domNode.nodeValue().trimmed(), references);
+            }
+        }
+        domNode = domNode.nextSibling();
+    }
+    text += QLatin1String("</>");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QHash<quint32, QPointF> PointValues(const VContainer &data)
+{
+    QHash<quint32, QPointF> points;
+    const QHash<quint32, QSharedPointer<VGObject> > *objects = data.DataGObjects();
+    for (auto i = objects->constBegin(); i != objects->constEnd(); ++i)
+    {
+        if (i.value()->getType() == GOType::Point)
+        {
+            points.insert(i.key(), static_cast<QPointF>(*i.value().staticCast<VPointF>()));
+        }
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Points both containers have must match. Returns ids of points that differ.
+QVector<quint32> DifferentPoints(const QHash<quint32, QPointF> &points, const QHash<quint32, QPointF> &expected)
+{
+    QVector<quint32> ids;
+    for (auto i = points.constBegin(); i != points.constEnd(); ++i)
+    {
+        const auto point = expected.constFind(i.key());
+        if (point != expected.constEnd() && not VFuzzyComparePoints(point.value(), i.value()))
+        {
+            ids.append(i.key());
+        }
+    }
+    return ids;
+}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -107,7 +255,12 @@ VPattern::VPattern(VContainer *data, Draw *mode, VMainGraphicsScene *draftScene,
       data(data),
       mode(mode),
       draftScene(draftScene),
-      pieceScene(pieceScene)
+      pieceScene(pieceScene),
+      dependencyGraph(),
+      objectTools(),
+      incrementsSignature(0),
+      incrementalParse(false),
+      changedTools()
 {
     SCASSERT(draftScene != nullptr)
     SCASSERT(pieceScene != nullptr)
@@ -142,6 +295,7 @@ void VPattern::CreateEmptyFile()
 
     this->appendChild(patternElement);
     insertBefore(createProcessingInstruction("xml", "version=\"1.0\" encoding=\"UTF-8\""), this->firstChild());
+    RefreshElementIdCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -210,6 +364,7 @@ void VPattern::Parse(const Document &parse)
                             changeActiveDraftBlock(GetParametrString(domElement, AttrName), Document::LiteParse);
                         }
                         ParseDrawElement(domElement, parse);
+                        AddBlockToGraph(domElement);
                         break;
                     case 1: // TagIncrements
                         qCDebug(vXML, "Tag increments.");
@@ -259,6 +414,7 @@ void VPattern::Parse(const Document &parse)
         }
         domNode = domNode.nextSibling();
     }
+    incrementsSignature = IncrementsSignature();
     emit CheckLayout();
 }
 
@@ -350,7 +506,23 @@ void VPattern::UpdateToolData(const quint32 &id, VContainer *data)
     ToolExists(id);
     VDataTool *tool = tools.value(id);
     SCASSERT(tool != nullptr)
-    tool->VDataTool::setData(data);
+    if (incrementalParse)
+    {
+        // Data of a tool must not know about objects created after the tool.
+        VContainer toolData = tool->getData();
+        toolData.RefreshFrom(*data, changedTools.contains(id) ? id : NULL_ID);
+        tool->VDataTool::setData(&toolData);
+    }
+    else
+    {
+        tool->VDataTool::setData(data);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VContainer *VPattern::GetPatternData() const
+{
+    return data;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -443,7 +615,7 @@ void VPattern::LiteParseIncrements()
     {
         emit SetEnabledGUI(true);
 
-        VContainer::ClearUniqueIncrementNames();
+        data->ClearUniqueIncrementNames();
         data->ClearVariables(VarType::Increment);
 
         const QDomNodeList tags = elementsByTagName(TagIncrements);
@@ -515,6 +687,8 @@ void VPattern::LiteParseTree(const Document &parse)
 {
     // Save current draft block name
     QString draftBlockName = activeDraftBlock;
+    bool partial = false;
+    QVector<quint32> updated;
 
     try
     {
@@ -527,6 +701,31 @@ void VPattern::LiteParseTree(const Document &parse)
             case Document::LiteParse:
                 Parse(parse);
                 break;
+            case Document::IncrementalParse:
+            case Document::IncrementalPPParse:
+                partial = Seamly2DSettings()->IsIncrementalParse() && ParseDependents(updated);
+                if (not partial && parse == Document::IncrementalPPParse)
+                {
+                    ParseCurrentPP();
+                }
+                else if (not partial)
+                {
+                    Parse(Document::LiteParse);
+                }
+                else if (Seamly2DSettings()->IsVerifyIncrementalParse())
+                {
+                    VerifyDependents();
+                    partial = false;
+                }
+                break;
+            case Document::PreviewParse:
+                // Preview runs on every tick of dragging, so the graph is used regardless of the setting.
+                partial = ParseDependents(updated);
+                if (not partial)
+                {
+                    ParseCurrentPP();
+                }
+                break;
             case Document::FullParse:
                 qCWarning(vXML, "Lite parsing doesn't support full parsing");
                 break;
@@ -547,7 +746,7 @@ void VPattern::LiteParseTree(const Document &parse)
         qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error parsing file.")), //-V807
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -558,7 +757,7 @@ void VPattern::LiteParseTree(const Document &parse)
         qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error can't convert value.")),
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -569,7 +768,7 @@ void VPattern::LiteParseTree(const Document &parse)
         qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error empty parameter.")),
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -580,7 +779,7 @@ void VPattern::LiteParseTree(const Document &parse)
         qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error wrong id.")),
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -591,7 +790,7 @@ void VPattern::LiteParseTree(const Document &parse)
         qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error parsing file.")),
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -601,7 +800,7 @@ void VPattern::LiteParseTree(const Document &parse)
     {
         qCCritical(vXML, "%s", qUtf8Printable(tr("Error parsing file (std::bad_alloc).")));
         emit SetEnabledGUI(false);
-        if (not VApplication::IsGUIMode())
+        if (not qApp->IsAppInGUIMode())
         {
             qApp->exit(V_EX_NOINPUT);
         }
@@ -611,8 +810,15 @@ void VPattern::LiteParseTree(const Document &parse)
     // Restore name current pattern piece
     activeDraftBlock = draftBlockName;
     qCDebug(vXML, "Current pattern piece %s", qUtf8Printable(activeDraftBlock));
-    setCurrentData();
-    emit FullUpdateFromFile();
+    if (partial)
+    {
+        emit PartialUpdateFromFile(updated);
+    }
+    else
+    {
+        setCurrentData();
+        emit FullUpdateFromFile();
+    }
     // Recalculate scene rect
     VMainGraphicsView::NewSceneRect(draftScene, qApp->getSceneView());
     VMainGraphicsView::NewSceneRect(pieceScene, qApp->getSceneView());
@@ -740,6 +946,27 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
     {
         scene = pieceScene;
     }
+    const QDomNodeList nodeList = node.childNodes();
+    const qint32 num = nodeList.size();
+    for (qint32 i = 0; i < num; ++i)
+    {
+        QDomElement domElement = nodeList.at(i).toElement();
+        if (domElement.isNull() == false)
+        {
+            ParseDrawModeElement(scene, domElement, parse);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseDrawModeElement parse one tag of calculation or modeling tag.
+ * @param scene scene of the draw mode.
+ * @param domElement tag in xml tree.
+ * @param parse parser file mode.
+ */
+void VPattern::ParseDrawModeElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
+{
     const QStringList tags = QStringList() << TagPoint
                                            << TagLine
                                            << TagSpline
@@ -748,52 +975,43 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
                                            << TagOperation
                                            << TagElArc
                                            << TagPath;
-    const QDomNodeList nodeList = node.childNodes();
-    const qint32 num = nodeList.size();
-    for (qint32 i = 0; i < num; ++i)
+    switch (tags.indexOf(domElement.tagName()))
     {
-        QDomElement domElement = nodeList.at(i).toElement();
-        if (domElement.isNull() == false)
-        {
-            switch (tags.indexOf(domElement.tagName()))
-            {
-                case 0: // TagPoint
-                    qCDebug(vXML, "Tag point.");
-                    ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 1: // TagLine
-                    qCDebug(vXML, "Tag line.");
-                    ParseLineElement(scene, domElement, parse);
-                    break;
-                case 2: // TagSpline
-                    qCDebug(vXML, "Tag spline.");
-                    ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 3: // TagArc
-                    qCDebug(vXML, "Tag arc.");
-                    ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 4: // TagTools
-                    qCDebug(vXML, "Tag tools.");
-                    ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 5: // TagOperation
-                    qCDebug(vXML, "Tag operation.");
-                    ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 6: // TagElArc
-                    qCDebug(vXML, "Tag elliptical arc.");
-                    ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 7: // TagPath
-                    qCDebug(vXML, "Tag path.");
-                    ParsePathElement(scene, domElement, parse);
-                    break;
-                default:
-                    VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
-                    throw e;
-            }
-        }
+        case 0: // TagPoint
+            qCDebug(vXML, "Tag point.");
+            ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 1: // TagLine
+            qCDebug(vXML, "Tag line.");
+            ParseLineElement(scene, domElement, parse);
+            break;
+        case 2: // TagSpline
+            qCDebug(vXML, "Tag spline.");
+            ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 3: // TagArc
+            qCDebug(vXML, "Tag arc.");
+            ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 4: // TagTools
+            qCDebug(vXML, "Tag tools.");
+            ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 5: // TagOperation
+            qCDebug(vXML, "Tag operation.");
+            ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 6: // TagElArc
+            qCDebug(vXML, "Tag elliptical arc.");
+            ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 7: // TagPath
+            qCDebug(vXML, "Tag path.");
+            ParsePathElement(scene, domElement, parse);
+            break;
+        default:
+            VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
+            throw e;
     }
 }
 
@@ -815,11 +1033,11 @@ void VPattern::ParseDetailElement(QDomElement &domElement, const Document &parse
         detail.SetMy(qApp->toPixel(GetParametrDouble(domElement, AttrMy, "0.0")));
         detail.SetSeamAllowance(getParameterBool(domElement, VToolSeamAllowance::AttrSeamAllowance, falseStr));
         detail.setHideSeamLine(getParameterBool(domElement, VToolSeamAllowance::AttrHideSeamLine,
-                                               QString().setNum(qApp->Seamly2DSettings()->isHideSeamLine())));
+                                               QString().setNum(qApp->Settings()->isHideSeamLine())));
         detail.SetSeamAllowanceBuiltIn(getParameterBool(domElement, VToolSeamAllowance::AttrSeamAllowanceBuiltIn,
                                                        falseStr));
         detail.SetForbidFlipping(getParameterBool(domElement, VToolSeamAllowance::AttrForbidFlipping,
-                                           QString().setNum(qApp->Seamly2DSettings()->getForbidPieceFlipping())));
+                                           QString().setNum(qApp->Settings()->getForbidPieceFlipping())));
         detail.SetInLayout(getParameterBool(domElement, AttrInLayout, trueStr));
         detail.SetUnited(getParameterBool(domElement, VToolSeamAllowance::AttrUnited, falseStr));
 
@@ -1188,17 +1406,371 @@ void VPattern::ParseCurrentPP()
     if (GetActivDrawElement(domElement))
     {
         ParseDrawElement(domElement, Document::LiteParse);
+        AddBlockToGraph(domElement);
     }
     emit CheckLayout();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseDependents recalculate only changed tools of the active draft block and tools that depend on them.
+ *
+ * Changed tools are found by signatures of their tags saved in the dependency graph on last parse.
+ * @param updated receives ids of recalculated tools in order of recalculation.
+ * @return false if the change can't be handled this way (tools were added or removed, increments or names were
+ * changed, the change touches other draft blocks). Lite parse, or lite parse of the active draft block for
+ * Document::IncrementalPPParse, must be used instead.
+ */
+bool VPattern::ParseDependents(QVector<quint32> &updated)
+{
+    if (dependencyGraph.Count() == 0 || IncrementsSignature() != incrementsSignature)
+    {
+        return false;
+    }
+
+    QHash<quint32, QDomElement> elements;
+    QVector<quint32> changed;
+    const QDomNodeList draws = elementsByTagName(TagDraw);
+    for (int i = 0; i < draws.size(); ++i)
+    {
+        const QDomElement drawElement = draws.at(i).toElement();
+        const QString block = GetParametrString(drawElement, AttrName);
+        const QVector<QDomElement> blockElements = ToolElements(drawElement);
+        for (int j = 0; j < blockElements.size(); ++j)
+        {
+            const QDomElement &domElement = blockElements.at(j);
+            const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+            if (not dependencyGraph.Contains(id) || dependencyGraph.Block(id) != block)
+            {
+                return false;
+            }
+
+            if (ElementSignature(domElement) != dependencyGraph.Signature(id))
+            {
+                // New names mean new variables
+                if (block != activeDraftBlock || domElement.attribute(AttrName) != dependencyGraph.Name(id))
+                {
+                    return false;
+                }
+                changed.append(id);
+            }
+            elements.insert(id, domElement);
+        }
+    }
+
+    if (elements.size() != dependencyGraph.Count())
+    {
+        return false;
+    }
+
+    updated = dependencyGraph.Dependents(changed);
+    for (int i = 0; i < updated.size(); ++i)
+    {
+        if (dependencyGraph.Block(updated.at(i)) != activeDraftBlock)
+        {
+            return false;
+        }
+    }
+
+    qCDebug(vXML, "Incremental parse of %d tools.", updated.size());
+
+    // Copies share the data, so they only remember which values were there before the recalculation
+    const QHash<quint32, QSharedPointer<VGObject> > oldObjects = *data->DataGObjects();
+    const QHash<QString, QSharedPointer<VInternalVariable> > oldVariables = *data->DataVariables();
+
+    incrementalParse = true;
+    for (int i = 0; i < changed.size(); ++i)
+    {
+        changedTools.insert(changed.at(i));
+    }
+    try
+    {
+        for (int i = 0; i < updated.size(); ++i)
+        {
+            QDomElement domElement = elements.value(updated.at(i));
+            if (domElement.tagName() == TagDetail)
+            {
+                ParseDetailElement(domElement, Document::LiteParse);
+            }
+            else
+            {
+                const bool modeling = domElement.parentNode().toElement().tagName() == TagModeling;
+                ParseDrawModeElement(modeling ? pieceScene : draftScene, domElement, Document::LiteParse);
+            }
+        }
+
+        // Tools that were not recalculated still keep old values of recalculated objects in their data. Data of the
+        // last tool of a block is also the data of the block, see setCurrentData(). Only data that holds any of the
+        // recalculated values is touched.
+        QSet<quint32> recalculated;
+        for (int i = 0; i < updated.size(); ++i)
+        {
+            recalculated.insert(updated.at(i));
+        }
+
+        QSet<quint32> objects;
+        const QHash<quint32, QSharedPointer<VGObject> > *newObjects = data->DataGObjects();
+        for (auto i = newObjects->constBegin(); i != newObjects->constEnd(); ++i)
+        {
+            if (oldObjects.value(i.key()) != i.value())
+            {
+                objects.insert(i.key());
+            }
+        }
+
+        QSet<QString> variables;
+        const QHash<QString, QSharedPointer<VInternalVariable> > *newVariables = data->DataVariables();
+        for (auto i = newVariables->constBegin(); i != newVariables->constEnd(); ++i)
+        {
+            if (oldVariables.value(i.key()) != i.value())
+            {
+                variables.insert(i.key());
+            }
+        }
+
+        for (auto i = tools.constBegin(); i != tools.constEnd(); ++i)
+        {
+            if (not recalculated.contains(i.key()))
+            {
+                VContainer toolData = i.value()->getData();
+                if (toolData.RefreshFrom(*data, objects, variables))
+                {
+                    i.value()->VDataTool::setData(&toolData);
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        incrementalParse = false;
+        changedTools.clear();
+        throw;
+    }
+    incrementalParse = false;
+    changedTools.clear();
+
+    data->RemoveVariable(currentLength);
+    data->RemoveVariable(currentSeamAllowance);
+
+    // Changed formulas can use other tools now
+    for (int i = 0; i < changed.size(); ++i)
+    {
+        AddToolToGraph(elements.value(changed.at(i)), activeDraftBlock);
+    }
+
+    for (int i = 0; i < updated.size(); ++i)
+    {
+        VAbstractTool *tool = qobject_cast<VAbstractTool *>(tools.value(updated.at(i)));
+        if (tool != nullptr)
+        {
+            tool->FullUpdateFromFile();
+        }
+    }
+
+    emit CheckLayout();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VerifyDependents repeat incremental recalculation with lite parse and report points that differ.
+ */
+void VPattern::VerifyDependents()
+{
+    const QHash<quint32, QPointF> points = PointValues(*data);
+
+    Parse(Document::LiteParse);
+    setCurrentData();
+
+    const QVector<quint32> ids = DifferentPoints(points, PointValues(*data));
+    for (int i = 0; i < ids.size(); ++i)
+    {
+        qCWarning(vXML, "Incremental parse result differs from lite parse for object %u.", ids.at(i));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ToolElements return tags of tools of a draft block in parse order: calculation, modeling, details.
+ */
+QVector<QDomElement> VPattern::ToolElements(const QDomElement &drawElement) const
+{
+    QVector<QDomElement> elements;
+    QDomElement modeElement = drawElement.firstChildElement();
+    while (not modeElement.isNull())
+    {
+        const QString tag = modeElement.tagName();
+        if (tag == TagCalculation || tag == TagModeling || tag == TagDetails)
+        {
+            QDomElement domElement = modeElement.firstChildElement();
+            while (not domElement.isNull())
+            {
+                if (tag != TagDetails || domElement.tagName() == TagDetail)
+                {
+                    elements.append(domElement);
+                }
+                domElement = domElement.nextSiblingElement();
+            }
+        }
+        modeElement = modeElement.nextSiblingElement();
+    }
+    return elements;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddBlockToGraph add tools of a just parsed draft block to the dependency graph.
+ *
+ * Must be called right after parsing the block while data still has its objects.
+ */
+void VPattern::AddBlockToGraph(const QDomElement &drawElement)
+{
+    const QString block = GetParametrString(drawElement, AttrName);
+    const QVector<QDomElement> elements = ToolElements(drawElement);
+
+    QVector<quint32> ids;
+    ids.reserve(elements.size());
+    for (int i = 0; i < elements.size(); ++i)
+    {
+        ids.append(GetParametrUInt(elements.at(i), AttrId, NULL_ID_STR));
+    }
+    std::sort(ids.begin(), ids.end());
+
+    // Operations mark objects with their id, other tools give their extra objects ids right after own id.
+    const QHash<quint32, QSharedPointer<VGObject> > *objects = data->DataGObjects();
+    for (auto i = objects->constBegin(); i != objects->constEnd(); ++i)
+    {
+        if (objectTools.contains(i.key()))
+        {
+            continue;
+        }
+
+        quint32 tool = i.value()->getIdTool();
+        if (not std::binary_search(ids.constBegin(), ids.constEnd(), tool))
+        {
+            const auto next = std::upper_bound(ids.constBegin(), ids.constEnd(), i.key());
+            tool = next == ids.constBegin() ? NULL_ID : *(next - 1);
+        }
+
+        if (tool != NULL_ID)
+        {
+            objectTools.insert(i.key(), tool);
+        }
+    }
+
+    for (int i = 0; i < elements.size(); ++i)
+    {
+        AddToolToGraph(elements.at(i), block);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddToolToGraph add or replace a tool in the dependency graph.
+ *
+ * A tool depends on tools whose objects it refers to by id, and on tools whose objects define variables used in its
+ * formulas.
+ */
+void VPattern::AddToolToGraph(const QDomElement &domElement, const QString &block)
+{
+    const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+    if (id == NULL_ID)
+    {
+        return;
+    }
+
+    QSet<quint32> references;
+    QSet<QString> tokens;
+    const uint signature = ElementSignature(domElement, &references, &tokens);
+    dependencyGraph.AddNode(id, block, signature, domElement.attribute(AttrName));
+
+    for (auto i = references.constBegin(); i != references.constEnd(); ++i)
+    {
+        dependencyGraph.AddDependency(id, ReferencedTool(*i));
+    }
+
+    const QHash<QString, QSharedPointer<VInternalVariable> > *variables = data->DataVariables();
+    for (auto i = tokens.constBegin(); i != tokens.constEnd(); ++i)
+    {
+        const auto variable = variables->constFind(*i);
+        if (variable == variables->constEnd())
+        {
+            continue;
+        }
+
+        switch (variable.value()->GetType())
+        {
+            case VarType::LineLength:
+            {
+                const QSharedPointer<VLengthLine> length = variable.value().staticCast<VLengthLine>();
+                dependencyGraph.AddDependency(id, ReferencedTool(length->GetP1Id()));
+                dependencyGraph.AddDependency(id, ReferencedTool(length->GetP2Id()));
+                break;
+            }
+            case VarType::LineAngle:
+            {
+                const QSharedPointer<VLineAngle> angle = variable.value().staticCast<VLineAngle>();
+                dependencyGraph.AddDependency(id, ReferencedTool(angle->GetP1Id()));
+                dependencyGraph.AddDependency(id, ReferencedTool(angle->GetP2Id()));
+                break;
+            }
+            case VarType::CurveLength:
+            case VarType::CurveCLength:
+            case VarType::CurveAngle:
+            case VarType::ArcRadius:
+            {
+                const QSharedPointer<VCurveVariable> curve = variable.value().staticCast<VCurveVariable>();
+                dependencyGraph.AddDependency(id, ReferencedTool(curve->GetId()));
+                dependencyGraph.AddDependency(id, ReferencedTool(curve->GetParentId()));
+                break;
+            }
+            case VarType::Measurement:
+            case VarType::Increment:
+            case VarType::Unknown:
+            default:
+                break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+quint32 VPattern::ReferencedTool(quint32 id) const
+{
+    if (dependencyGraph.Contains(id))
+    {
+        return id;
+    }
+    return objectTools.value(id, NULL_ID);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ElementSignature return hash of a tag with all its attributes and children.
+ * @param references if not null receives ids of objects from reference attributes and pin records of the tag.
+ * @param tokens if not null receives words of other attributes, candidates for names of variables in formulas.
+ */
+uint VPattern::ElementSignature(const QDomElement &domElement, QSet<quint32> *references,
+                                QSet<QString> *tokens) const
+{
+    QString text;
+    ScanElement(domElement, text, references, tokens);
+    return qHash(text);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+uint VPattern::IncrementsSignature() const
+{
+    const QDomNodeList list = elementsByTagName(TagIncrements);
+    return list.isEmpty() ? 0 : ElementSignature(list.at(0).toElement());
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VPattern::GetLabelBase(quint32 index) const
 {
-    const QStringList list = VApplication::LabelLanguages();
+    const QStringList list = VSettings::LabelLanguages();
     const QString def = QStringLiteral("A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,Q,R,S,T,U,V,W,X,Y,Z");
     QStringList alphabet;
-    switch (list.indexOf(qApp->Seamly2DSettings()->GetLabelLanguage()))
+    switch (list.indexOf(Seamly2DSettings()->GetLabelLanguage()))
     {
         case 0: // de
         {
@@ -3124,6 +3696,7 @@ void VPattern::GarbageCollector()
                     else
                     { // Parent was deleted. We do not need this object anymore
                         modElement.removeChild(modNode);
+                        UncacheElementIds(modNode);
                     }
                 }
                 else
@@ -3646,7 +4219,7 @@ QString VPattern::GenerateLabel(const LabelType &type, const QString &reservedNa
 QString VPattern::GenerateSuffix(const QString &type) const
 {
     const QString suffixBase = GetLabelBase(static_cast<quint32>(GetIndexActivPP())).toLower();
-    const QStringList uniqueNames = VContainer::AllUniqueNames();
+    const QStringList uniqueNames = data->AllUniqueNames();
     qint32 num = 1;
     QString suffix;
     for (;;)
@@ -3902,10 +4475,15 @@ void VPattern::PrepareForParse(const Document &parse)
         tools.clear();
         cursor = 0;
         history.clear();
+
+        dependencyGraph.Clear();
+        objectTools.clear();
     }
     else if (parse == Document::LiteParse)
     {
-        VContainer::ClearUniqueNames();
+        dependencyGraph.Clear();
+        objectTools.clear();
+        data->ClearUniqueNames();
         data->ClearVariables(VarType::Increment);
         data->ClearVariables(VarType::LineAngle);
         data->ClearVariables(VarType::LineLength);
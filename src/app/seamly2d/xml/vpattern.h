@@ -53,6 +53,7 @@
 #define VPATTERN_H
 
 #include "../ifc/xml/vabstractpattern.h"
+#include "../ifc/xml/vdependencygraph.h"
 #include "../ifc/xml/vtoolrecord.h"
 #include "../vpatterndb/vcontainer.h"
 #include "../ifc/xml/vpatternconverter.h"
@@ -76,6 +77,7 @@ class VPattern : public VAbstractPattern
 
     void           setCurrentData();
     virtual void   UpdateToolData(const quint32 &id, VContainer *data) Q_DECL_OVERRIDE;
+    virtual VContainer *GetPatternData() const Q_DECL_OVERRIDE;
 
     virtual void   IncrementReferens(quint32 id) const Q_DECL_OVERRIDE;
     virtual void   DecrementReferens(quint32 id) const Q_DECL_OVERRIDE;
@@ -138,10 +140,24 @@ public slots:
     VMainGraphicsScene *draftScene;
     VMainGraphicsScene *pieceScene;
 
+    /** @brief dependencyGraph which tools use results of which tools, built on every parse. */
+    VDependencyGraph        dependencyGraph;
+
+    /** @brief objectTools tool that created an object, by object id. */
+    QHash<quint32, quint32> objectTools;
+
+    /** @brief incrementsSignature hash of increments at last full parse. */
+    uint                    incrementsSignature;
+
+    /** @brief incrementalParse true while only dependent tools are recalculated. */
+    bool                    incrementalParse;
+    QSet<quint32>           changedTools;
+
     VNodeDetail    ParseDetailNode(const QDomElement &domElement) const;
 
     void           ParseDrawElement(const QDomNode& node, const Document &parse);
     void           ParseDrawMode(const QDomNode& node, const Document &parse, const Draw &mode);
+    void           ParseDrawModeElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse);
     void           ParseDetailElement(QDomElement &domElement, const Document &parse);
     void           ParseDetailNodes(const QDomElement &domElement, VPiece &detail, qreal width, bool closed) const;
     void           ParsePieceDataTag(const QDomElement &domElement, VPiece &detail) const;
@@ -179,6 +195,16 @@ public slots:
     template <typename T>
     QRectF         ToolBoundingRect(const QRectF &rec, const quint32 &id) const;
     void           ParseCurrentPP();
+    bool           ParseDependents(QVector<quint32> &updated);
+    void           VerifyDependents();
+
+    QVector<QDomElement> ToolElements(const QDomElement &drawElement) const;
+    void           AddBlockToGraph(const QDomElement &drawElement);
+    void           AddToolToGraph(const QDomElement &domElement, const QString &block);
+    quint32        ReferencedTool(quint32 id) const;
+    uint           ElementSignature(const QDomElement &domElement, QSet<quint32> *references = nullptr,
+                                    QSet<QString> *tokens = nullptr) const;
+    uint           IncrementsSignature() const;
     QString        GetLabelBase(quint32 index)const;
 
     void ParseToolBasePoint(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse);
@@ -2056,13 +2056,13 @@ void TMainWindow::InitWindow()
 
 		labelGradationHeights = new QLabel(tr("Height:"));
 		gradationHeights = SetGradationList(labelGradationHeights, listHeights);
-		SetDefaultHeight(static_cast<int>(VContainer::height()));
+		SetDefaultHeight(static_cast<int>(data->height()));
 		connect(gradationHeights, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
                 this, &TMainWindow::ChangedHeight);
 
 		labelGradationSizes = new QLabel(tr("Size:"));
 		gradationSizes = SetGradationList(labelGradationSizes, listSizes);
-		SetDefaultSize(static_cast<int>(VContainer::size()));
+		SetDefaultSize(static_cast<int>(data->size()));
 		connect(gradationSizes, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
                 this, &TMainWindow::ChangedSize);
 
@@ -2402,7 +2402,7 @@ void TMainWindow::SetDefaultSize(int value)
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::RefreshData(bool freshCall)
 {
-	VContainer::ClearUniqueNames();
+	data->ClearUniqueNames();
 	data->ClearVariables(VarType::Measurement);
 	individualMeasurements->ReadMeasurements();
 
@@ -96,6 +96,12 @@ void VLitePattern::UpdateToolData(const quint32 &id, VContainer *data)
     Q_UNUSED(data)
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+VContainer *VLitePattern::GetPatternData() const
+{
+    return nullptr;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLitePattern::LiteParseTree(const Document &parse)
 {
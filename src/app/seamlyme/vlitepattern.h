@@ -69,6 +69,7 @@ class VLitePattern : public VAbstractPattern
     virtual QString GenerateSuffix(const QString &type) const Q_DECL_OVERRIDE;
 
     virtual void    UpdateToolData(const quint32 &id, VContainer *data) Q_DECL_OVERRIDE;
+    virtual VContainer *GetPatternData() const Q_DECL_OVERRIDE;
 
 public slots:
     virtual void    LiteParseTree(const Document &parse) Q_DECL_OVERRIDE;
@@ -221,7 +221,6 @@ const QString VAbstractPattern::NodePoint               = QStringLiteral("NodePo
 const QString VAbstractPattern::NodeSpline              = QStringLiteral("NodeSpline");
 const QString VAbstractPattern::NodeSplinePath          = QStringLiteral("NodeSplinePath");
 
-QHash<quint32, VDataTool*> VAbstractPattern::tools = QHash<quint32, VDataTool*>();
 QVector<VLabelTemplateLine> VAbstractPattern::patternLabelLines = QVector<VLabelTemplateLine>();
 bool VAbstractPattern::patternLabelWasChanged = false;
 
@@ -258,6 +257,7 @@ VAbstractPattern::VAbstractPattern(QObject *parent)
     ,  history(QVector<VToolRecord>())
     ,  patternPieces(QStringList())
      , modified(false)
+     , tools(QHash<quint32, VDataTool*>())
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -450,7 +450,10 @@ void VAbstractPattern::ParseGroups(const QDomElement &domElement)
             {
                 if (domElement.tagName() == TagGroup)
                 {
-                    VContainer::UpdateId(GetParametrUInt(domElement, AttrId, NULL_ID_STR));
+                    if (VContainer *data = GetPatternData())
+                    {
+                        data->UpdateId(GetParametrUInt(domElement, AttrId, NULL_ID_STR));
+                    }
 
                     const QPair<bool, QMap<quint32, quint32> > groupData = ParseItemElement(domElement);
                     const QMap<quint32, quint32> group = groupData.second;
@@ -610,7 +613,7 @@ void VAbstractPattern::setCursor(const quint32 &value)
  * @param id tool id.
  * @return tool.
  */
-VDataTool *VAbstractPattern::getTool(quint32 id)
+VDataTool *doc->getTool(quint32 id) const
 {
     ToolExists(id);
     return tools.value(id);
@@ -622,7 +625,7 @@ VDataTool *VAbstractPattern::getTool(quint32 id)
  * @param id tool id.
  * @param tool tool.
  */
-void VAbstractPattern::AddTool(quint32 id, VDataTool *tool)
+void doc->AddTool(quint32 id, VDataTool *tool)
 {
     Q_ASSERT_X(id != 0, Q_FUNC_INFO, "id == 0");
     SCASSERT(tool != nullptr)
@@ -630,7 +633,7 @@ void VAbstractPattern::AddTool(quint32 id, VDataTool *tool)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VAbstractPattern::RemoveTool(quint32 id)
+void doc->RemoveTool(quint32 id)
 {
     tools.remove(id);
 }
@@ -1562,7 +1565,7 @@ void VAbstractPattern::SelectedDetail(quint32 id)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VAbstractPattern::ToolExists(const quint32 &id)
+void VAbstractPattern::ToolExists(const quint32 &id) const
 {
     if (tools.contains(id) == false)
     {
@@ -1667,6 +1670,7 @@ void VAbstractPattern::InsertTag(const QStringList &tags, const QDomElement &ele
         if (not list.isEmpty())
         {
             pattern.insertAfter(element, list.at(0));
+            CacheElementIds(element);
             break;
         }
     }
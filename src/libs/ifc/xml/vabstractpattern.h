@@ -71,7 +71,7 @@ class QDomElement;
 class VPiecePath;
 class VPieceNode;
 
-enum class Document : char { LiteParse, LitePPParse, FullParse };
+enum class Document : char { LiteParse, LitePPParse, FullParse, IncrementalParse, IncrementalPPParse, PreviewParse };
 enum class LabelType : char {NewPatternPiece, NewLabel};
 
 // Don't touch values!!!. Same values stored in xml.
@@ -129,10 +129,11 @@ class VAbstractPattern : public QObject, public VDomDocument
     virtual QString GenerateSuffix(const QString &type) const=0;
 
     virtual void   UpdateToolData(const quint32 &id, VContainer *data)=0;
+    virtual VContainer *GetPatternData() const=0;
 
-    static VDataTool* getTool(quint32 id);
-    static void       AddTool(quint32 id, VDataTool *tool);
-    static void       RemoveTool(quint32 id);
+    VDataTool*     getTool(quint32 id) const;
+    void           AddTool(quint32 id, VDataTool *tool);
+    void           RemoveTool(quint32 id);
 
     static VPiecePath              ParsePieceNodes(const QDomElement &domElement);
     static QVector<CustomSARecord> ParsePieceCSARecords(const QDomElement &domElement);
@@ -375,6 +376,12 @@ class VAbstractPattern : public QObject, public VDomDocument
      * @brief FullUpdateFromFile update tool data form file.
      */
     void           FullUpdateFromFile();
+    /**
+     * @brief PartialUpdateFromFile only these tools were recalculated after a change, the rest of the pattern is the
+     * same.
+     * @param ids ids of recalculated tools.
+     */
+    void           PartialUpdateFromFile(const QVector<quint32> &ids);
     /**
      * @brief patternChanged emit if we have unsaved change.
      */
@@ -422,13 +429,14 @@ public slots:
     /** @brief modified keep state of the document for cases that do not cover QUndoStack*/
     mutable bool   modified;
 
-    /** @brief tools list with pointer on tools. */
-    static QHash<quint32, VDataTool*> tools;
+    /** @brief tools list with pointer on tools of this pattern. */
+    QHash<quint32, VDataTool*> tools;
+
     /** @brief patternLabelLines list to speed up reading a template by many pieces. */
     static QVector<VLabelTemplateLine> patternLabelLines;
     static bool patternLabelWasChanged;
 
-    static void       ToolExists(const quint32 &id);
+    void              ToolExists(const quint32 &id) const;
     static VPiecePath ParsePathNodes(const QDomElement &domElement);
     static VPieceNode ParseSANode(const QDomElement &domElement);
 
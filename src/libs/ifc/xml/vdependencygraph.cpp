@@ -0,0 +1,185 @@
+/**************************************************************************
+ **
+ **  @file   vdependencygraph.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vdependencygraph.h"
+
+#include <QQueue>
+#include <QSet>
+#include <algorithm>
+
+//---------------------------------------------------------------------------------------------------------------------
+VDependencyGraph::VDependencyGraph()
+    : nodes(),
+      nextOrder(0)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::Clear()
+{
+    nodes.clear();
+    nextOrder = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddNode add a tool or replace it if the graph already has it.
+ *
+ * Dependencies of a replaced tool are removed, tools that depend on it stay. Order of a replaced tool doesn't change.
+ * @param id tool id.
+ * @param block name of the draft block.
+ * @param signature hash of the tool tag, used to find changed tools.
+ * @param name name the tool gives to its objects and variables.
+ */
+void VDependencyGraph::AddNode(quint32 id, const QString &block, uint signature, const QString &name)
+{
+    auto node = nodes.find(id);
+    if (node == nodes.end())
+    {
+        node = nodes.insert(id, Node());
+        node->order = nextOrder++;
+    }
+    else
+    {
+        for (int i = 0; i < node->dependencies.size(); ++i)
+        {
+            auto dependency = nodes.find(node->dependencies.at(i));
+            if (dependency != nodes.end())
+            {
+                dependency->dependents.removeAll(id);
+            }
+        }
+        node->dependencies.clear();
+    }
+
+    node->block = block;
+    node->signature = signature;
+    node->name = name;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddDependency remember that tool id uses results of tool dependsOn. Both tools must be in the graph.
+ */
+void VDependencyGraph::AddDependency(quint32 id, quint32 dependsOn)
+{
+    if (id == dependsOn)
+    {
+        return;
+    }
+
+    auto node = nodes.find(id);
+    auto dependency = nodes.find(dependsOn);
+    if (node == nodes.end() || dependency == nodes.end() || node->dependencies.contains(dependsOn))
+    {
+        return;
+    }
+
+    node->dependencies.append(dependsOn);
+    dependency->dependents.append(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDependencyGraph::Contains(quint32 id) const
+{
+    return nodes.contains(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VDependencyGraph::Count() const
+{
+    return nodes.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VDependencyGraph::Block(quint32 id) const
+{
+    return nodes.value(id).block;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+uint VDependencyGraph::Signature(quint32 id) const
+{
+    return nodes.value(id).signature;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VDependencyGraph::Name(quint32 id) const
+{
+    return nodes.value(id).name;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<quint32> VDependencyGraph::Dependencies(quint32 id) const
+{
+    return nodes.value(id).dependencies;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Dependents return tools ids and all tools that directly or indirectly depend on them.
+ * @return ids in order the tools were added, the order they must be recalculated. Unknown ids are skipped.
+ */
+QVector<quint32> VDependencyGraph::Dependents(const QVector<quint32> &ids) const
+{
+    QSet<quint32> visited;
+    QQueue<quint32> queue;
+    for (int i = 0; i < ids.size(); ++i)
+    {
+        if (nodes.contains(ids.at(i)) && not visited.contains(ids.at(i)))
+        {
+            visited.insert(ids.at(i));
+            queue.enqueue(ids.at(i));
+        }
+    }
+
+    while (not queue.isEmpty())
+    {
+        const QVector<quint32> dependents = nodes.value(queue.dequeue()).dependents;
+        for (int i = 0; i < dependents.size(); ++i)
+        {
+            if (not visited.contains(dependents.at(i)))
+            {
+                visited.insert(dependents.at(i));
+                queue.enqueue(dependents.at(i));
+            }
+        }
+    }
+
+    QVector<quint32> closure;
+    closure.reserve(visited.size());
+    for (auto i = visited.constBegin(); i != visited.constEnd(); ++i)
+    {
+        closure.append(*i);
+    }
+
+    std::sort(closure.begin(), closure.end(), [this](quint32 id1, quint32 id2)
+    {
+        return nodes.value(id1).order < nodes.value(id2).order;
+    });
+    return closure;
+}
@@ -0,0 +1,87 @@
+/**************************************************************************
+ **
+ **  @file   vdependencygraph.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VDEPENDENCYGRAPH_H
+#define VDEPENDENCYGRAPH_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VDependencyGraph class keeps which tools of a pattern use results of which tools.
+ *
+ * Nodes are tools (points, curves, operations, nodes of pieces, pieces) identified by tool id. Every node remembers
+ * its draft block, signature of its tag in the file and order of appearance, so after a change a pattern can find the
+ * changed tools and recalculate only them and the tools that depend on them.
+ */
+class VDependencyGraph
+{
+public:
+    VDependencyGraph();
+
+    void Clear();
+
+    void AddNode(quint32 id, const QString &block, uint signature, const QString &name);
+    void AddDependency(quint32 id, quint32 dependsOn);
+
+    bool    Contains(quint32 id) const;
+    int     Count() const;
+    QString Block(quint32 id) const;
+    uint    Signature(quint32 id) const;
+    QString Name(quint32 id) const;
+
+    QVector<quint32> Dependencies(quint32 id) const;
+    QVector<quint32> Dependents(const QVector<quint32> &ids) const;
+
+private:
+    struct Node
+    {
+        Node()
+            : block(),
+              signature(0),
+              name(),
+              order(0),
+              dependencies(),
+              dependents()
+        {}
+
+        QString          block;
+        uint             signature;
+        QString          name;
+        int              order;
+        QVector<quint32> dependencies;
+        QVector<quint32> dependents;
+    };
+
+    QHash<quint32, Node> nodes;
+    int                  nextOrder;
+};
+
+#endif // VDEPENDENCYGRAPH_H
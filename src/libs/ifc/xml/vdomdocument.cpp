@@ -219,6 +219,12 @@ VDomDocument::VDomDocument()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief elementById find element by id using the index. Never scans the document.
+ * @param id id value.
+ * @param tagName if not empty, element must also have this tag name.
+ * @return element or null element if the id is unknown.
+ */
 QDomElement VDomDocument::elementById(quint32 id, const QString &tagName)
 {
     if (id == 0)
@@ -226,91 +232,114 @@ QDomElement VDomDocument::elementById(quint32 id, const QString &tagName)
         return QDomElement();
     }
 
-    if (map.contains(id))
+    const QDomElement e = map.value(id);
+    if (e.isNull())
     {
-       const QDomElement e = map[id];
-       if (e.parentNode().nodeType() != QDomNode::BaseNode)
-       {
-           return e;
-       }
-       map.remove(id);
+        return QDomElement();
+    }
+
+    if (e.parentNode().nodeType() == QDomNode::BaseNode)
+    {// Element was detached from the document without updating the index
+        map.remove(id);
+        return QDomElement();
     }
 
-    if (tagName.isEmpty())
+    if (not tagName.isEmpty() && e.tagName() != tagName)
     {
-        if (this->find(this->documentElement(), id))
-        {
-           return map[id];
-        }
+        return QDomElement();
     }
-    else
+
+    return e;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshElementIdCache rebuild the index of ids for the whole document.
+ */
+void VDomDocument::RefreshElementIdCache()
+{
+    map.clear();
+    CacheElementIds(documentElement());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CacheElementIds add node and all its children with id to the index. Call after inserting a node.
+ * @param node inserted node.
+ */
+void VDomDocument::CacheElementIds(const QDomElement &node)
+{
+    QVector<QDomElement> stack;
+    if (not node.isNull())
     {
-        const QDomNodeList list = elementsByTagName(tagName);
-        for (int i=0; i < list.size(); ++i)
+        stack.append(node);
+    }
+
+    while (not stack.isEmpty())
+    {
+        const QDomElement element = stack.takeLast();
+        const quint32 id = ElementId(element);
+        if (id != NULL_ID)
         {
-            const QDomElement domElement = list.at(i).toElement();
-            if (not domElement.isNull() && domElement.hasAttribute(AttrId))
-            {
-                try
-                {
-                    const quint32 elementId = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+            map.insert(id, element);
+        }
 
-                    this->map[elementId] = domElement;
-                    if (elementId == id)
-                    {
-                        return domElement;
-                    }
-                }
-                catch (const VExceptionConversionError &)
-                {
-                    // do nothing
-                }
-            }
+        QDomElement child = element.firstChildElement();
+        while (not child.isNull())
+        {
+            stack.append(child);
+            child = child.nextSiblingElement();
         }
     }
-
-    return QDomElement();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Find element by id.
- * @param node node
- * @param id id value
- * @return true if found
+ * @brief UncacheElementIds remove node and all its children from the index. Call after removing a node.
+ * @param node removed node.
  */
-bool VDomDocument::find(const QDomElement &node, quint32 id)
+void VDomDocument::UncacheElementIds(const QDomElement &node)
 {
-    if (node.hasAttribute(AttrId))
+    QVector<QDomElement> stack;
+    if (not node.isNull())
     {
-        try
-        {
-            const quint32 elementId = GetParametrUInt(node, AttrId, NULL_ID_STR);
+        stack.append(node);
+    }
 
-            this->map[elementId] = node;
-            if (elementId == id)
-            {
-                return true;
-            }
+    while (not stack.isEmpty())
+    {
+        const QDomElement element = stack.takeLast();
+        const quint32 id = ElementId(element);
+        if (id != NULL_ID && map.value(id) == element)
+        {
+            map.remove(id);
         }
-        catch (const VExceptionConversionError &)
+
+        QDomElement child = element.firstChildElement();
+        while (not child.isNull())
         {
-            // do nothing
+            stack.append(child);
+            child = child.nextSiblingElement();
         }
     }
+}
 
-    for (qint32 i=0; i<node.childNodes().length(); ++i)
+//---------------------------------------------------------------------------------------------------------------------
+quint32 VDomDocument::ElementId(const QDomElement &element)
+{
+    if (not element.hasAttribute(AttrId))
     {
-        const QDomNode n = node.childNodes().at(i);
-        if (n.isElement())
-        {
-            if (this->find(n.toElement(), id))
-            {
-                return true;
-            }
-        }
+        return NULL_ID;
+    }
+
+    try
+    {
+        return GetParametrUInt(element, AttrId, NULL_ID_STR);
+    }
+    catch (const VExceptionConversionError &)
+    {
+        return NULL_ID;
     }
-    return false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -720,6 +749,8 @@ void VDomDocument::setXMLContent(const QString &fileName)
                              .arg(fileName));
         throw e;
     }
+
+    RefreshElementIdCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
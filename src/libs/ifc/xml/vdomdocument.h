@@ -120,6 +120,10 @@ class VDomDocument : public QDomDocument
     virtual ~VDomDocument() Q_DECL_EQ_DEFAULT;
     QDomElement elementById(quint32 id, const QString &tagName = QString());
 
+    void        RefreshElementIdCache();
+    void        CacheElementIds(const QDomElement &node);
+    void        UncacheElementIds(const QDomElement &node);
+
     template <typename T>
     void SetAttribute(QDomElement &domElement, const QString &name, const T &value) const;
 
@@ -166,10 +170,10 @@ class VDomDocument : public QDomDocument
 
 private:
     Q_DISABLE_COPY(VDomDocument)
-    /** @brief Map used for finding element by id. */
+    /** @brief Index of all elements with id. Built on load and updated when elements are inserted or removed. */
     QHash<quint32, QDomElement> map;
 
-    bool           find(const QDomElement &node, quint32 id);
+    static quint32 ElementId(const QDomElement &element);
 
     bool SaveCanonicalXML(QIODevice *file, int indent, QString &error) const;
 };
@@ -124,6 +124,7 @@ void VAbstractArc::SetFormulaF1(const QString &formula, qreal value)
 {
     d->formulaF1 = formula;
     d->f1 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -143,6 +144,7 @@ void VAbstractArc::SetFormulaF2(const QString &formula, qreal value)
 {
     d->formulaF2 = formula;
     d->f2 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -161,6 +163,7 @@ VPointF VAbstractArc::GetCenter() const
 void VAbstractArc::SetCenter(const VPointF &point)
 {
     d->center = point;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -235,6 +238,7 @@ qreal VAbstractArc::AngleArc() const
 void VAbstractArc::SetFlipped(bool value)
 {
     d->isFlipped = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
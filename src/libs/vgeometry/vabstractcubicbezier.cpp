@@ -54,12 +54,99 @@
 #include <QLineF>
 #include <QMessageLogger>
 #include <QPoint>
+#include <QVarLengthArray>
 #include <QtDebug>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "../vgeometry/vpointf.h"
 
+namespace
+{
+struct BezierSegment
+{
+    qreal x1;
+    qreal y1;
+    qreal x2;
+    qreal y2;
+    qreal x3;
+    qreal y3;
+    qreal x4;
+    qreal y4;
+    qint16 level;
+};
+
+// Gauss-Legendre quadrature of order 16. Nodes on [-1, 1] are symmetric, so only the positive half is stored.
+const int gaussHalfOrder = 8;
+const qreal gaussAbscissae[gaussHalfOrder] = {0.0950125098376374, 0.2816035507792589, 0.4580167776572274,
+                                              0.6178762444026438, 0.7554044083550030, 0.8656312023878318,
+                                              0.9445750230732326, 0.9894009349916499};
+const qreal gaussWeights[gaussHalfOrder] = {0.1894506104550685, 0.1826034150449236, 0.1691565193950026,
+                                            0.1495959888165768, 0.1246289712555339, 0.0951585116824929,
+                                            0.0622535239386478, 0.0271524594117541};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BezierSpeed length of the derivative of cubic bezier curve at parameter t.
+ */
+qreal BezierSpeed(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal t)
+{
+    const qreal mt = 1 - t;
+    const QPointF derivative = 3 * (mt * mt * (p2 - p1) + 2 * mt * t * (p3 - p2) + t * t * (p4 - p3));
+    return qSqrt(derivative.x() * derivative.x() + derivative.y() * derivative.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GaussLegendreLength length of cubic bezier curve between parameters a and b, one quadrature panel.
+ */
+qreal GaussLegendreLength(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal a,
+                          qreal b)
+{
+    const qreal halfRange = (b - a) / 2;
+    const qreal middle = a + halfRange;
+    qreal sum = 0;
+    for (int i = 0; i < gaussHalfOrder; ++i)
+    {
+        const qreal offset = halfRange * gaussAbscissae[i];
+        sum += gaussWeights[i] * (BezierSpeed(p1, p2, p3, p4, middle - offset) +
+                                  BezierSpeed(p1, p2, p3, p4, middle + offset));
+    }
+    return sum * halfRange;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AdaptiveLength splits the panel in halves until both halves agree with the whole. Near cusps one panel is
+ * not enough.
+ */
+qreal AdaptiveLength(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal a, qreal b,
+                     qreal whole, qreal tolerance, int depth)
+{
+    const qreal middle = (a + b) / 2;
+    const qreal left = GaussLegendreLength(p1, p2, p3, p4, a, middle);
+    const qreal right = GaussLegendreLength(p1, p2, p3, p4, middle, b);
+
+    if (depth <= 0 || qAbs(left + right - whole) <= tolerance)
+    {
+        return left + right;
+    }
+
+    return AdaptiveLength(p1, p2, p3, p4, a, middle, left, tolerance / 2, depth - 1) +
+           AdaptiveLength(p1, p2, p3, p4, middle, b, right, tolerance / 2, depth - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BezierArcLength length of cubic bezier curve from parameter 0 to parameter t.
+ */
+qreal BezierArcLength(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal t)
+{
+    const qreal whole = GaussLegendreLength(p1, p2, p3, p4, 0, t);
+    return AdaptiveLength(p1, p2, p3, p4, 0, t, whole, whole * 1e-7, 10);
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractCubicBezier::VAbstractCubicBezier(const GOType &type, const quint32 &idObject, const Draw &mode)
     : VAbstractBezier(type, idObject, mode)
@@ -169,27 +256,73 @@ QString VAbstractCubicBezier::NameForHistory(const QString &toolName) const
 //---------------------------------------------------------------------------------------------------------------------
 qreal VAbstractCubicBezier::GetParmT(qreal length) const
 {
-    if (length < 0)
+    return ParamAtLength(length);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LengthAtParam length of the curve from the first point to parameter t. Doesn't flatten the curve, the
+ * integral of the derivative is calculated by Gauss-Legendre quadrature.
+ * @param t parameter in range [0; 1].
+ * @return length.
+ */
+qreal VAbstractCubicBezier::LengthAtParam(qreal t) const
+{
+    t = qBound(0.0, t, 1.0);
+    return BezierArcLength(static_cast<QPointF>(GetP1()), GetControlPoint1(), GetControlPoint2(),
+                           static_cast<QPointF>(GetP4()), t);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParamAtLength find parameter t where length of the curve from the first point reaches the length.
+ *
+ * Newton iterations on LengthAtParam(). A step that leaves the current bracket falls back to bisection.
+ * @param length length along the curve.
+ * @return parameter in range [0; 1].
+ */
+qreal VAbstractCubicBezier::ParamAtLength(qreal length) const
+{
+    if (length <= 0)
     {
         return 0;
     }
-    else if (length > GetLength())
+
+    const QPointF p1 = static_cast<QPointF>(GetP1());
+    const QPointF p2 = GetControlPoint1();
+    const QPointF p3 = GetControlPoint2();
+    const QPointF p4 = static_cast<QPointF>(GetP4());
+
+    const qreal fullLength = BezierArcLength(p1, p2, p3, p4, 1);
+    if (length >= fullLength)
     {
-        length = GetLength();
+        return 1;
     }
 
-    const qreal eps = 0.001 * length;
-    qreal parT = 0.5;
-    qreal step = parT;
-    qreal splLength = LengthT(parT);
+    const qreal eps = fullLength * 1e-8;
+    qreal low = 0;
+    qreal high = 1;
+    qreal t = length / fullLength;
 
-    while (qAbs(splLength - length) > eps)
+    for (int i = 0; i < 50; ++i)
     {
-        step /= 2.0;
-        splLength > length ? parT -= step : parT += step;
-        splLength = LengthT(parT);
+        const qreal diff = BezierArcLength(p1, p2, p3, p4, t) - length;
+        if (qAbs(diff) <= eps)
+        {
+            break;
+        }
+
+        diff > 0 ? high = t : low = t;
+
+        const qreal speed = BezierSpeed(p1, p2, p3, p4, t);
+        qreal next = (speed > 0) ? t - diff / speed : low;
+        if (next <= low || next >= high)
+        {
+            next = (low + high) / 2;
+        }
+        t = next;
     }
-    return parT;
+    return t;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -222,304 +355,181 @@ qreal VAbstractCubicBezier::CalcSqDistance(qreal x1, qreal y1, qreal x2, qreal y
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief PointBezier_r find spline point using four point of spline.
- * @param x1 х coordinate first point.
- * @param y1 у coordinate first point.
- * @param x2 х coordinate first control point.
- * @param y2 у coordinate first control point.
- * @param x3 х coordinate second control point.
- * @param y3 у coordinate second control point.
- * @param x4 х coordinate last point.
- * @param y4 у coordinate last point.
- * @param level level of recursion. In the begin 0.
- * @param px list х coordinat spline points.
- * @param py list у coordinat spline points.
+ * @brief PointBezier find inner points of spline using four point of spline.
+ *
+ * Adaptive subdivision that walks the halves of the curve with an explicit stack instead of recursion. Points are
+ * appended in order from the first to the last spline point, the end points are not included.
+ * @param p1 first spline point.
+ * @param p2 first control point.
+ * @param p3 second control point.
+ * @param p4 last spline point.
+ * @param approximationScale bigger scale gives smaller tolerance and more points.
+ * @param points list where points are appended.
  */
-void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2, qreal x3, qreal y3, qreal x4, qreal y4,
-                                         qint16 level, QVector<qreal> &px, QVector<qreal> &py)
+void VAbstractCubicBezier::PointBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4,
+                                       qreal approximationScale, QVector<QPointF> &points)
 {
-    if (px.size() >= 2)
-    {
-        for (int i=1; i < px.size(); ++i)
-        {
-            if (QPointF(px.at(i-1), py.at(i-1)) == QPointF(px.at(i), py.at(i)))
-            {
-                qDebug("All neighbors points in path must be unique.");
-            }
-        }
-    }
-
-    const double curve_collinearity_epsilon                 = 1e-30;
-    const double curve_angle_tolerance_epsilon              = 0.01;
-    const double m_angle_tolerance = 0.0;
+    const double curve_collinearity_epsilon = 1e-30;
     enum curve_recursion_limit_e { curve_recursion_limit = 32 };
-    const double m_cusp_limit = 0.0;
-    double m_approximation_scale = 1.0;
-    double m_distance_tolerance_square;
 
-    m_distance_tolerance_square = 0.5 / m_approximation_scale;
+    double m_distance_tolerance_square = 0.5 / approximationScale;
     m_distance_tolerance_square *= m_distance_tolerance_square;
 
-    if (level > curve_recursion_limit)
-    {
-        return;
-    }
+    // Depth of the walk is limited, so is the size of the stack
+    QVarLengthArray<BezierSegment, curve_recursion_limit + 2> stack;
+    const BezierSegment whole = {p1.x(), p1.y(), p2.x(), p2.y(), p3.x(), p3.y(), p4.x(), p4.y(), 0};
+    stack.append(whole);
 
-    // Calculate all the mid-points of the line segments
-    //----------------------
-    const double x12   = (x1 + x2) / 2;
-    const double y12   = (y1 + y2) / 2;
-    const double x23   = (x2 + x3) / 2;
-    const double y23   = (y2 + y3) / 2;
-    const double x34   = (x3 + x4) / 2;
-    const double y34   = (y3 + y4) / 2;
-    const double x123  = (x12 + x23) / 2;
-    const double y123  = (y12 + y23) / 2;
-    const double x234  = (x23 + x34) / 2;
-    const double y234  = (y23 + y34) / 2;
-    const double x1234 = (x123 + x234) / 2;
-    const double y1234 = (y123 + y234) / 2;
-
-
-    // Try to approximate the full cubic curve by a single straight line
-    //------------------
-    const double dx = x4-x1;
-    const double dy = y4-y1;
-
-    double d2 = fabs((x2 - x4) * dy - (y2 - y4) * dx);
-    double d3 = fabs((x3 - x4) * dy - (y3 - y4) * dx);
-
-    switch ((static_cast<int>(d2 > curve_collinearity_epsilon) << 1) +
-             static_cast<int>(d3 > curve_collinearity_epsilon))
+    while (not stack.isEmpty())
     {
-        case 0:
-        {
-            // All collinear OR p1==p4
-            //----------------------
-            double k = dx*dx + dy*dy;
-            if (k < 0.000000001)
-            {
-                d2 = CalcSqDistance(x1, y1, x2, y2);
-                d3 = CalcSqDistance(x4, y4, x3, y3);
-            }
-            else
-            {
-                k   = 1 / k;
-                {
-                    const double da1 = x2 - x1;
-                    const double da2 = y2 - y1;
-                    d2  = k * (da1*dx + da2*dy);
-                }
-                {
-                    const double da1 = x3 - x1;
-                    const double da2 = y3 - y1;
-                    d3  = k * (da1*dx + da2*dy);
-                }
-                if (d2 > 0 && d2 < 1 && d3 > 0 && d3 < 1)
-                {
-                    // Simple collinear case, 1---2---3---4
-                    // We can leave just two endpoints
-                    return;
-                }
-                if (d2 <= 0)
-                {
-                    d2 = CalcSqDistance(x2, y2, x1, y1);
-                }
-                else if (d2 >= 1)
-                {
-                    d2 = CalcSqDistance(x2, y2, x4, y4);
-                }
-                else
-                {
-                    d2 = CalcSqDistance(x2, y2, x1 + d2*dx, y1 + d2*dy);
-                }
+        const BezierSegment s = stack.last();
+        stack.removeLast();
 
-                if (d3 <= 0)
-                {
-                    d3 = CalcSqDistance(x3, y3, x1, y1);
-                }
-                else if (d3 >= 1)
-                {
-                    d3 = CalcSqDistance(x3, y3, x4, y4);
-                }
-                else
-                {
-                    d3 = CalcSqDistance(x3, y3, x1 + d3*dx, y1 + d3*dy);
-                }
-            }
-            if (d2 > d3)
-            {
-                if (d2 < m_distance_tolerance_square)
-                {
-                    px.append(x2);
-                    py.append(y2);
-                    return;
-                }
-            }
-            else
-            {
-                if (d3 < m_distance_tolerance_square)
-                {
-                    px.append(x3);
-                    py.append(y3);
-                    return;
-                }
-            }
-            break;
+        if (s.level > curve_recursion_limit)
+        {
+            continue;
         }
-        case 1:
+
+        const double x1 = s.x1, y1 = s.y1, x2 = s.x2, y2 = s.y2, x3 = s.x3, y3 = s.y3, x4 = s.x4, y4 = s.y4;
+
+        // Calculate all the mid-points of the line segments
+        //----------------------
+        const double x12   = (x1 + x2) / 2;
+        const double y12   = (y1 + y2) / 2;
+        const double x23   = (x2 + x3) / 2;
+        const double y23   = (y2 + y3) / 2;
+        const double x34   = (x3 + x4) / 2;
+        const double y34   = (y3 + y4) / 2;
+        const double x123  = (x12 + x23) / 2;
+        const double y123  = (y12 + y23) / 2;
+        const double x234  = (x23 + x34) / 2;
+        const double y234  = (y23 + y34) / 2;
+        const double x1234 = (x123 + x234) / 2;
+        const double y1234 = (y123 + y234) / 2;
+
+        // Try to approximate the full cubic curve by a single straight line
+        //------------------
+        const double dx = x4-x1;
+        const double dy = y4-y1;
+
+        double d2 = fabs((x2 - x4) * dy - (y2 - y4) * dx);
+        double d3 = fabs((x3 - x4) * dy - (y3 - y4) * dx);
+
+        bool flat = false;
+        switch ((static_cast<int>(d2 > curve_collinearity_epsilon) << 1) +
+                 static_cast<int>(d3 > curve_collinearity_epsilon))
         {
-            // p1,p2,p4 are collinear, p3 is significant
-            //----------------------
-            if (d3 * d3 <= m_distance_tolerance_square * (dx*dx + dy*dy))
+            case 0:
             {
-                if (m_angle_tolerance < curve_angle_tolerance_epsilon)
-                {
-                    px.append(x23);
-                    py.append(y23);
-                    return;
-                }
-
-                // Angle Condition
+                // All collinear OR p1==p4
                 //----------------------
-                double da1 = fabs(atan2(y4 - y3, x4 - x3) - atan2(y3 - y2, x3 - x2));
-                if (da1 >= M_PI)
+                double k = dx*dx + dy*dy;
+                if (k < 0.000000001)
                 {
-                    da1 = M_2PI - da1;
+                    d2 = CalcSqDistance(x1, y1, x2, y2);
+                    d3 = CalcSqDistance(x4, y4, x3, y3);
                 }
-
-                if (da1 < m_angle_tolerance)
+                else
                 {
-                    px.append(x2);
-                    py.append(y2);
-
-                    px.append(x3);
-                    py.append(y3);
-                    return;
-                }
+                    k   = 1 / k;
+                    d2  = k * ((x2 - x1)*dx + (y2 - y1)*dy);
+                    d3  = k * ((x3 - x1)*dx + (y3 - y1)*dy);
 
-                if (m_cusp_limit > 0.0 || m_cusp_limit < 0.0)
-                {
-                    if (da1 > m_cusp_limit)
+                    if (d2 > 0 && d2 < 1 && d3 > 0 && d3 < 1)
                     {
-                        px.append(x3);
-                        py.append(y3);
-                        return;
+                        // Simple collinear case, 1---2---3---4
+                        // We can leave just two endpoints
+                        flat = true;
+                        break;
                     }
-                }
-            }
-            break;
-        }
-        case 2:
-        {
-            // p1,p3,p4 are collinear, p2 is significant
-            //----------------------
-            if (d2 * d2 <= m_distance_tolerance_square * (dx*dx + dy*dy))
-            {
-                if (m_angle_tolerance < curve_angle_tolerance_epsilon)
-                {
-                    px.append(x23);
-                    py.append(y23);
-                    return;
-                }
-
-                // Angle Condition
-                //----------------------
-                double da1 = fabs(atan2(y3 - y2, x3 - x2) - atan2(y2 - y1, x2 - x1));
-                if (da1 >= M_PI)
-                {
-                    da1 = M_2PI - da1;
-                }
 
-                if (da1 < m_angle_tolerance)
-                {
-                    px.append(x2);
-                    py.append(y2);
+                    if (d2 <= 0)
+                    {
+                        d2 = CalcSqDistance(x2, y2, x1, y1);
+                    }
+                    else if (d2 >= 1)
+                    {
+                        d2 = CalcSqDistance(x2, y2, x4, y4);
+                    }
+                    else
+                    {
+                        d2 = CalcSqDistance(x2, y2, x1 + d2*dx, y1 + d2*dy);
+                    }
 
-                    px.append(x3);
-                    py.append(y3);
-                    return;
+                    if (d3 <= 0)
+                    {
+                        d3 = CalcSqDistance(x3, y3, x1, y1);
+                    }
+                    else if (d3 >= 1)
+                    {
+                        d3 = CalcSqDistance(x3, y3, x4, y4);
+                    }
+                    else
+                    {
+                        d3 = CalcSqDistance(x3, y3, x1 + d3*dx, y1 + d3*dy);
+                    }
                 }
 
-                if (m_cusp_limit > 0.0 || m_cusp_limit < 0.0)
+                if (d2 > d3)
                 {
-                    if (da1 > m_cusp_limit)
+                    if (d2 < m_distance_tolerance_square)
                     {
-                        px.append(x2);
-                        py.append(y2);
-                        return;
+                        points.append(QPointF(x2, y2));
+                        flat = true;
                     }
                 }
-            }
-            break;
-        }
-        case 3:
-        {
-            // Regular case
-            //-----------------
-            if ((d2 + d3)*(d2 + d3) <= m_distance_tolerance_square * (dx*dx + dy*dy))
-            {
-                // If the curvature doesn't exceed the distance_tolerance value
-                // we tend to finish subdivisions.
-                //----------------------
-                if (m_angle_tolerance < curve_angle_tolerance_epsilon)
+                else if (d3 < m_distance_tolerance_square)
                 {
-                    px.append(x23);
-                    py.append(y23);
-                    return;
+                    points.append(QPointF(x3, y3));
+                    flat = true;
                 }
-
-                // Angle & Cusp Condition
+                break;
+            }
+            case 1:
+                // p1,p2,p4 are collinear, p3 is significant
                 //----------------------
-                const double k   = atan2(y3 - y2, x3 - x2);
-                double da1 = fabs(k - atan2(y2 - y1, x2 - x1));
-                double da2 = fabs(atan2(y4 - y3, x4 - x3) - k);
-                if (da1 >= M_PI)
+                if (d3 * d3 <= m_distance_tolerance_square * (dx*dx + dy*dy))
                 {
-                    da1 = M_2PI - da1;
+                    points.append(QPointF(x23, y23));
+                    flat = true;
                 }
-                if (da2 >= M_PI)
+                break;
+            case 2:
+                // p1,p3,p4 are collinear, p2 is significant
+                //----------------------
+                if (d2 * d2 <= m_distance_tolerance_square * (dx*dx + dy*dy))
                 {
-                    da2 = M_2PI - da2;
+                    points.append(QPointF(x23, y23));
+                    flat = true;
                 }
-
-                if (da1 + da2 < m_angle_tolerance)
+                break;
+            case 3:
+                // Regular case
+                //-----------------
+                if ((d2 + d3)*(d2 + d3) <= m_distance_tolerance_square * (dx*dx + dy*dy))
                 {
-                    // Finally we can stop the recursion
+                    // If the curvature doesn't exceed the distance_tolerance value
+                    // we tend to finish subdivisions.
                     //----------------------
-
-                    px.append(x23);
-                    py.append(y23);
-                    return;
+                    points.append(QPointF(x23, y23));
+                    flat = true;
                 }
+                break;
+            default:
+                break;
+        }
 
-                if (m_cusp_limit > 0.0 || m_cusp_limit < 0.0)
-                {
-                    if (da1 > m_cusp_limit)
-                    {
-                        px.append(x2);
-                        py.append(y2);
-                        return;
-                    }
-
-                    if (da2 > m_cusp_limit)
-                    {
-                        px.append(x3);
-                        py.append(y3);
-                        return;
-                    }
-                }
-            }
-            break;
+        if (not flat)
+        {
+            // Continue subdivision. The second half goes first to the stack, so the first half is processed first.
+            //----------------------
+            const qint16 level = static_cast<qint16>(s.level + 1);
+            const BezierSegment second = {x1234, y1234, x234, y234, x34, y34, x4, y4, level};
+            const BezierSegment first = {x1, y1, x12, y12, x123, y123, x1234, y1234, level};
+            stack.append(second);
+            stack.append(first);
         }
-        default:
-            break;
     }
-
-    // Continue subdivision
-    //----------------------
-    PointBezier_r(x1, y1, x12, y12, x123, y123, x1234, y1234, static_cast<qint16>(level + 1), px, py);
-    PointBezier_r(x1234, y1234, x234, y234, x34, y34, x4, y4, static_cast<qint16>(level + 1), px, py);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -529,27 +539,39 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
  * @param p2 first control point.
  * @param p3 second control point.
  * @param p4 last spline point.
+ * @param approximationScale bigger scale gives smaller tolerance and more points.
  * @return list of points.
  */
 QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
-                                                            const QPointF &p4)
+                                                            const QPointF &p4, qreal approximationScale)
 {
     QVector<QPointF> pvector;
-    QVector<qreal> x;
-    QVector<qreal> y;
-    QVector<qreal>& wx = x;
-    QVector<qreal>& wy = y;
-    x.append ( p1.x () );
-    y.append ( p1.y () );
-    PointBezier_r ( p1.x (), p1.y (), p2.x (), p2.y (),
-                    p3.x (), p3.y (), p4.x (), p4.y (), 0, wx, wy );
-    x.append ( p4.x () );
-    y.append ( p4.y () );
-    for ( qint32 i = 0; i < x.count(); ++i )
+    pvector.reserve(64);
+    pvector.append(p1);
+    PointBezier(p1, p2, p3, p4, approximationScale, pvector);
+    pvector.append(p4);
+
+#ifndef V_NO_ASSERT
+    ValidateBezierPoints(pvector);
+#endif
+
+    return pvector;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidateBezierPoints debug check that all neighbors points are unique. Not called in release builds.
+ */
+void VAbstractCubicBezier::ValidateBezierPoints(const QVector<QPointF> &points)
+{
+    for (int i=1; i < points.size(); ++i)
     {
-        pvector.append( QPointF ( x.at(i), y.at(i)) );
+        if (points.at(i-1) == points.at(i))
+        {
+            qDebug("All neighbors points in path must be unique.");
+            return;
+        }
     }
-    return pvector;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
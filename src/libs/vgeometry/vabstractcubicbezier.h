@@ -84,14 +84,18 @@ class VAbstractCubicBezier : public VAbstractBezier
     qreal GetParmT(qreal length) const;
     qreal LengthT(qreal t) const;
 
+    qreal LengthAtParam(qreal t) const;
+    qreal ParamAtLength(qreal length) const;
+
 protected:
     virtual void CreateName() Q_DECL_OVERRIDE;
 
     static qreal            CalcSqDistance(qreal x1, qreal y1, qreal x2, qreal y2);
-    static void             PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2, qreal x3, qreal y3, qreal x4,
-                                          qreal y4, qint16 level, QVector<qreal> &px, QVector<qreal> &py);
+    static void             PointBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4,
+                                        qreal approximationScale, QVector<QPointF> &points);
     static QVector<QPointF> GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
-                                                 const QPointF &p4);
+                                                 const QPointF &p4, qreal approximationScale = 1.0);
+    static void             ValidateBezierPoints(const QVector<QPointF> &points);
     static qreal            LengthBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4);
 
     virtual QPointF GetControlPoint1() const =0;
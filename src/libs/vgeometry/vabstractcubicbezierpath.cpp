@@ -129,12 +129,8 @@ QVector<QPointF> VAbstractCubicBezierPath::GetPoints() const
  */
 qreal VAbstractCubicBezierPath::GetLength() const
 {
-    qreal length = 0;
-    for (qint32 i = 1; i <= CountSubSpl(); ++i)
-    {
-        length += GetSpline(i).GetLength();
-    }
-    return length;
+    // Points of the path are points of all splines, so length is the sum of their lengths
+    return CachedLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
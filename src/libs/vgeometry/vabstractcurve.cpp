@@ -54,12 +54,191 @@
 #include <QLine>
 #include <QLineF>
 #include <QMessageLogger>
+#include <QMutexLocker>
 #include <QPainterPath>
 #include <QPoint>
+#include <QVarLengthArray>
 #include <QtDebug>
+#include <algorithm>
 
 #include "vabstractcurve_p.h"
 
+namespace
+{
+const int segmentsPerLeaf = 4;
+
+//---------------------------------------------------------------------------------------------------------------------
+int BuildSegmentsBoxes(const QVector<QPointF> &points, int first, int last, QVector<SegmentsBox> &boxes)
+{
+    const int index = boxes.size();
+    boxes.append(SegmentsBox());
+
+    SegmentsBox box;
+    box.first = first;
+    box.last = last;
+
+    if (last - first <= segmentsPerLeaf)
+    {
+        box.left = -1;
+        box.right = -1;
+        box.minX = box.maxX = points.at(first).x();
+        box.minY = box.maxY = points.at(first).y();
+        for (int i = first + 1; i <= last; ++i)
+        {
+            const QPointF &p = points.at(i);
+            box.minX = qMin(box.minX, p.x());
+            box.minY = qMin(box.minY, p.y());
+            box.maxX = qMax(box.maxX, p.x());
+            box.maxY = qMax(box.maxY, p.y());
+        }
+    }
+    else
+    {
+        const int middle = first + (last - first) / 2;
+        box.left = BuildSegmentsBoxes(points, first, middle, boxes);
+        box.right = BuildSegmentsBoxes(points, middle, last, boxes);
+
+        const SegmentsBox &left = boxes.at(box.left);
+        const SegmentsBox &right = boxes.at(box.right);
+        box.minX = qMin(left.minX, right.minX);
+        box.minY = qMin(left.minY, right.minY);
+        box.maxX = qMax(left.maxX, right.maxX);
+        box.maxY = qMax(left.maxY, right.maxY);
+    }
+
+    boxes[index] = box;
+    return index;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<SegmentsBox> SegmentsBoxes(const QVector<QPointF> &points)
+{
+    QVector<SegmentsBox> boxes;
+    boxes.reserve(2 * (points.size() / segmentsPerLeaf + 1));
+    BuildSegmentsBoxes(points, 0, points.size() - 1, boxes);
+    return boxes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool BoxesOverlap(const SegmentsBox &box1, const SegmentsBox &box2)
+{
+    // Unlike QRectF::intersects() boxes of horizontal and vertical segments are not empty
+    return box1.minX <= box2.maxX && box2.minX <= box1.maxX && box1.minY <= box2.maxY && box2.minY <= box1.maxY;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SegmentsCross the same math as QLineF::intersects(), but also returns positions on both segments.
+ */
+bool SegmentsCross(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, CurvesCrossing &crossing)
+{
+    const QPointF a = p2 - p1;
+    const QPointF b = p3 - p4;
+    const QPointF c = p1 - p3;
+
+    const qreal denominator = a.y() * b.x() - a.x() * b.y();
+    // Exact test like in QLineF::intersects(), nearly parallel segments still cross
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_GCC("-Wfloat-equal")
+QT_WARNING_DISABLE_CLANG("-Wfloat-equal")
+    if (denominator == 0 || not qIsFinite(denominator))
+    {
+        return false;
+    }
+QT_WARNING_POP
+
+    const qreal reciprocal = 1 / denominator;
+    const qreal na = (b.y() * c.x() - b.x() * c.y()) * reciprocal;
+    if (na < 0 || na > 1)
+    {
+        return false;
+    }
+
+    const qreal nb = (a.x() * c.y() - a.y() * c.x()) * reciprocal;
+    if (nb < 0 || nb > 1)
+    {
+        return false;
+    }
+
+    crossing.point = p1 + a * na;
+    crossing.t1 = na;
+    crossing.t2 = nb;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool LineMissesBox(const QLineF &line, const SegmentsBox &box)
+{
+    if (qMax(line.x1(), line.x2()) < box.minX || qMin(line.x1(), line.x2()) > box.maxX
+            || qMax(line.y1(), line.y2()) < box.minY || qMin(line.y1(), line.y2()) > box.maxY)
+    {
+        return true;
+    }
+
+    // All corners on the same side of the line
+    const qreal dx = line.dx();
+    const qreal dy = line.dy();
+    const qreal side1 = dx * (box.minY - line.y1()) - dy * (box.minX - line.x1());
+    const qreal side2 = dx * (box.minY - line.y1()) - dy * (box.maxX - line.x1());
+    const qreal side3 = dx * (box.maxY - line.y1()) - dy * (box.minX - line.x1());
+    const qreal side4 = dx * (box.maxY - line.y1()) - dy * (box.maxX - line.x1());
+
+    return (side1 > 0 && side2 > 0 && side3 > 0 && side4 > 0)
+            || (side1 < 0 && side2 < 0 && side3 < 0 && side4 < 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LineCrossings find crossings of the line with the polyline. Leaves are visited from the first segment to the
+ * last, so crossings come in the same order as from VAbstractCurve::CurveIntersectLine().
+ */
+QVector<QPointF> LineCrossings(const QVector<QPointF> &points, const QVector<SegmentsBox> &boxes, const QLineF &line,
+                               bool firstOnly)
+{
+    QVector<QPointF> intersections;
+    if (boxes.isEmpty())
+    {
+        return intersections;
+    }
+
+    QVarLengthArray<int, 64> stack;
+    stack.append(0);
+
+    while (not stack.isEmpty())
+    {
+        const SegmentsBox &box = boxes.at(stack.last());
+        stack.removeLast();
+
+        if (LineMissesBox(line, box))
+        {
+            continue;
+        }
+
+        if (box.left >= 0)
+        {
+            stack.append(box.right);
+            stack.append(box.left);
+            continue;
+        }
+
+        for (int i = box.first; i < box.last; ++i)
+        {
+            CurvesCrossing crossing;
+            if (SegmentsCross(line.p1(), line.p2(), points.at(i), points.at(i+1), crossing))
+            {
+                intersections.append(crossing.point);
+                if (firstOnly)
+                {
+                    return intersections;
+                }
+            }
+        }
+    }
+
+    return intersections;
+}
+}
+
 const qreal VAbstractCurve::lengthCurveDirectionArrow = 14;
 
 #ifdef Q_COMPILER_RVALUE_REFS
@@ -122,7 +301,7 @@ QVector<QPointF> VAbstractCurve::GetSegmentPoints(const QVector<QPointF> &points
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VAbstractCurve::GetSegmentPoints(const QPointF &begin, const QPointF &end, bool reverse) const
 {
-    return GetSegmentPoints(GetPoints(), begin, end, reverse);
+    return GetSegmentPoints(CachedPoints(), begin, end, reverse);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -210,7 +389,7 @@ QPainterPath VAbstractCurve::GetPath() const
 {
     QPainterPath path;
 
-    const QVector<QPointF> points = GetPoints();
+    const QVector<QPointF> &points = CachedPoints();
     if (points.count() >= 2)
     {
         path.addPolygon(QPolygonF(points));
@@ -225,7 +404,7 @@ QPainterPath VAbstractCurve::GetPath() const
 //---------------------------------------------------------------------------------------------------------------------
 qreal VAbstractCurve::GetLengthByPoint(const QPointF &point) const
 {
-    const QVector<QPointF> points = GetPoints();
+    const QVector<QPointF> &points = CachedPoints();
     if (points.size() < 2)
     {
         return -1;
@@ -236,13 +415,23 @@ qreal VAbstractCurve::GetLengthByPoint(const QPointF &point) const
         return 0;
     }
 
-    bool ok = false;
-    const QVector<QPointF> segment = ToEnd(points, point, &ok);
-    if (not ok)
+    const QVector<qreal> &lengths = CachedLengths();
+
+    // Same rules as ToEnd(): the search goes from the last point back to the first
+    if (points.last().toPoint() == point.toPoint())
     {
-        return -1;
+        return lengths.last();
     }
-    return PathLength(segment);
+
+    for (qint32 i = points.size()-2; i >= 0; --i)
+    {
+        if (IsPointOnLineSegment(point, points.at(i), points.at(i+1)))
+        {
+            return lengths.at(i) + QLineF(points.at(i), point).length();
+        }
+    }
+
+    return -1;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -253,14 +442,13 @@ qreal VAbstractCurve::GetLengthByPoint(const QPointF &point) const
  */
 QVector<QPointF> VAbstractCurve::IntersectLine(const QLineF &line) const
 {
-    return CurveIntersectLine(this->GetPoints(), line);
+    return LineCrossings(CachedPoints(), CachedSegmentsBoxes(), line, false);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VAbstractCurve::IsIntersectLine(const QLineF &line) const
 {
-    const QVector<QPointF> points = IntersectLine(line);
-    return not points.isEmpty();
+    return not LineCrossings(CachedPoints(), CachedSegmentsBoxes(), line, true).isEmpty();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -291,7 +479,7 @@ bool VAbstractCurve::IsPointOnCurve(const QVector<QPointF> &points, const QPoint
 //---------------------------------------------------------------------------------------------------------------------
 bool VAbstractCurve::IsPointOnCurve(const QPointF &p) const
 {
-    return IsPointOnCurve(GetPoints(), p);
+    return IsPointOnCurve(CachedPoints(), p);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -347,30 +535,104 @@ QVector<QPointF> VAbstractCurve::CurveIntersectLine(const QVector<QPointF> &poin
     return intersections;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CurvesIntersect find all crossings of two polylines.
+ *
+ * Segments of both polylines are grouped in bounding box hierarchies. Only pairs of segments from overlapping leaves
+ * are tested.
+ * @param curve1 points of the first polyline.
+ * @param curve2 points of the second polyline.
+ * @return crossings ordered by position on the first polyline.
+ */
+QVector<CurvesCrossing> VAbstractCurve::CurvesIntersect(const QVector<QPointF> &curve1,
+                                                        const QVector<QPointF> &curve2)
+{
+    QVector<CurvesCrossing> crossings;
+    if (curve1.size() < 2 || curve2.size() < 2)
+    {
+        return crossings;
+    }
+
+    const QVector<SegmentsBox> boxes1 = SegmentsBoxes(curve1);
+    const QVector<SegmentsBox> boxes2 = SegmentsBoxes(curve2);
+
+    QVarLengthArray<QPair<int, int>, 64> stack;
+    stack.append(qMakePair(0, 0));
+
+    while (not stack.isEmpty())
+    {
+        const QPair<int, int> pair = stack.last();
+        stack.removeLast();
+
+        const SegmentsBox &box1 = boxes1.at(pair.first);
+        const SegmentsBox &box2 = boxes2.at(pair.second);
+
+        if (not BoxesOverlap(box1, box2))
+        {
+            continue;
+        }
+
+        if (box1.left < 0 && box2.left < 0)
+        {
+            for (int i = box1.first; i < box1.last; ++i)
+            {
+                for (int j = box2.first; j < box2.last; ++j)
+                {
+                    CurvesCrossing crossing;
+                    if (SegmentsCross(curve1.at(i), curve1.at(i+1), curve2.at(j), curve2.at(j+1), crossing))
+                    {
+                        crossing.t1 += i;
+                        crossing.t2 += j;
+                        crossings.append(crossing);
+                    }
+                }
+            }
+        }
+        else if (box2.left < 0 || (box1.left >= 0 && box1.last - box1.first >= box2.last - box2.first))
+        {
+            stack.append(qMakePair(box1.right, pair.second));
+            stack.append(qMakePair(box1.left, pair.second));
+        }
+        else
+        {
+            stack.append(qMakePair(pair.first, box2.right));
+            stack.append(qMakePair(pair.first, box2.left));
+        }
+    }
+
+    std::sort(crossings.begin(), crossings.end(), [](const CurvesCrossing &c1, const CurvesCrossing &c2)
+    {
+        return c1.t1 < c2.t1 || (c1.t1 <= c2.t1 && c1.t2 < c2.t2);
+    });
+
+    return crossings;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<DirectionArrow> VAbstractCurve::DirectionArrows() const
 {
     QVector<DirectionArrow> arrows;
 
-    const QVector<QPointF> points = GetPoints();
+    const QVector<QPointF> &points = CachedPoints();
     if (points.count() >= 2)
     {
-        /*Need find coordinate midle of curve.
-          Universal way is take all points and find sum.*/
+        // Need find coordinate midle of curve.
+        const QVector<qreal> &lengths = CachedLengths();
         const qreal seek_length = qAbs(GetLength())/2.0;
-        qreal found_length = 0;
+
+        const auto found = std::lower_bound(lengths.constBegin() + 1, lengths.constEnd(), seek_length);
         QLineF arrow;
-        for (qint32 i = 1; i <= points.size()-1; ++i)
+        if (found != lengths.constEnd())
         {
+            const int i = static_cast<int>(found - lengths.constBegin());
             arrow = QLineF(points.at(i-1), points.at(i));
-            found_length += arrow.length();//Length that we aready find
-
-            if (seek_length <= found_length)// if have found more that need stop.
-            {
-                //subtract length in last line and you will find position of the middle point.
-                arrow.setLength(arrow.length() - (found_length - seek_length));
-                break;
-            }
+            //subtract length before this line and you will find position of the middle point.
+            arrow.setLength(seek_length - lengths.at(i-1));
+        }
+        else
+        {
+            arrow = QLineF(points.at(points.size()-2), points.last());
         }
 
         //Reverse line because we want start arrow from this point
@@ -419,6 +681,93 @@ QPainterPath VAbstractCurve::ShowDirection(const QVector<DirectionArrow> &arrows
     return path;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResetCache forget flattened curve. Each setter that changes geometry of the curve must call it.
+ */
+void VAbstractCurve::ResetCache()
+{
+    QMutexLocker locker(&d->cacheMutex);
+    d->points.clear();
+    d->lengths.clear();
+    d->boxes.clear();
+    d->cached = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedPoints return the same points as GetPoints(), but calculate them only once.
+ */
+const QVector<QPointF> &VAbstractCurve::CachedPoints() const
+{
+    FillCache();
+    return d->points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedLengths return length along the curve for each point of CachedPoints().
+ */
+const QVector<qreal> &VAbstractCurve::CachedLengths() const
+{
+    FillCache();
+    return d->lengths;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedLength return length of flattened curve.
+ */
+qreal VAbstractCurve::CachedLength() const
+{
+    const QVector<qreal> &lengths = CachedLengths();
+    return lengths.isEmpty() ? 0 : lengths.last();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedSegmentsBoxes return bounding box hierarchy over segments of CachedPoints().
+ */
+const QVector<SegmentsBox> &VAbstractCurve::CachedSegmentsBoxes() const
+{
+    FillCache();
+    QMutexLocker locker(&d->cacheMutex);
+    if (d->boxes.isEmpty() && d->points.size() >= 2)
+    {
+        d->boxes = SegmentsBoxes(d->points);
+    }
+    return d->boxes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FillCache flatten the curve once. Filled cache is not changed until ResetCache(), so references to it stay
+ * valid after the lock is released.
+ */
+void VAbstractCurve::FillCache() const
+{
+    QMutexLocker locker(&d->cacheMutex);
+    if (d->cached)
+    {
+        return;
+    }
+
+    d->points = GetPoints();
+
+    d->lengths.resize(d->points.size());
+    qreal length = 0;
+    for (qint32 i = 0; i < d->points.size(); ++i)
+    {
+        if (i > 0)
+        {
+            length += QLineF(d->points.at(i-1), d->points.at(i)).length();
+        }
+        d->lengths[i] = length;
+    }
+
+    d->cached = true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 qreal VAbstractCurve::PathLength(const QVector<QPointF> &path)
 {
@@ -67,8 +67,22 @@
 
 typedef QPair<QLineF, QLineF> DirectionArrow;
 
+/**
+ * @brief The CurvesCrossing struct crossing point of two polylines. Position on a polyline: integer part is index of
+ * segment, fractional part is position on the segment.
+ */
+struct CurvesCrossing
+{
+    QPointF point;
+    qreal   t1;
+    qreal   t2;
+};
+
+Q_DECLARE_TYPEINFO(CurvesCrossing, Q_MOVABLE_TYPE);
+
 class QPainterPath;
 class VAbstractCurveData;
+struct SegmentsBox;
 
 class VAbstractCurve :public VGObject
 {
@@ -114,6 +128,7 @@ class VAbstractCurve :public VGObject
     static qreal             PathLength(const QVector<QPointF> &path);
 
     static QVector<QPointF>  CurveIntersectLine(const QVector<QPointF> &points, const QLineF &line);
+    static QVector<CurvesCrossing> CurvesIntersect(const QVector<QPointF> &curve1, const QVector<QPointF> &curve2);
 
     virtual QString          NameForHistory(const QString &toolName) const=0;
     virtual QVector<DirectionArrow> DirectionArrows() const;
@@ -122,9 +137,17 @@ class VAbstractCurve :public VGObject
     static const qreal lengthCurveDirectionArrow;
 protected:
     virtual void             CreateName() =0;
+
+    void                     ResetCache();
+    const QVector<QPointF>  &CachedPoints() const;
+    const QVector<qreal>    &CachedLengths() const;
+    qreal                    CachedLength() const;
 private:
     QSharedDataPointer<VAbstractCurveData> d;
 
+    void                     FillCache() const;
+    const QVector<SegmentsBox> &CachedSegmentsBoxes() const;
+
     static QVector<QPointF>  FromBegin(const QVector<QPointF> &points, const QPointF &begin, bool *ok = nullptr);
     static QVector<QPointF>  ToEnd(const QVector<QPointF> &points, const QPointF &end, bool *ok = nullptr);
 };
@@ -52,7 +52,11 @@
 #ifndef VABSTRACTCURVE_P_H
 #define VABSTRACTCURVE_P_H
 
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPointF>
 #include <QSharedData>
+#include <QVector>
 
 #include "../ifc/ifcdef.h"
 #include "../vmisc/diagnostic.h"
@@ -61,6 +65,23 @@ QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/**
+ * @brief The SegmentsBox struct node of bounding box hierarchy over segments [first; last) of a polyline.
+ */
+struct SegmentsBox
+{
+    qreal minX;
+    qreal minY;
+    qreal maxX;
+    qreal maxY;
+    int   first;
+    int   last;
+    int   left;  // -1 for leaf
+    int   right;
+};
+
+Q_DECLARE_TYPEINFO(SegmentsBox, Q_PRIMITIVE_TYPE);
+
 class VAbstractCurveData : public QSharedData
 {
 public:
@@ -68,15 +89,31 @@ class VAbstractCurveData : public QSharedData
     VAbstractCurveData ()
         : duplicate(0),
           color(ColorBlack),
-          penStyle(LineTypeSolidLine)
+          penStyle(LineTypeSolidLine),
+          points(),
+          lengths(),
+          boxes(),
+          cached(false),
+          cacheMutex()
     {}
 
     VAbstractCurveData(const VAbstractCurveData &curve)
         : QSharedData(curve),
           duplicate(curve.duplicate),
           color(curve.color),
-          penStyle(curve.penStyle)
-    {}
+          penStyle(curve.penStyle),
+          points(),
+          lengths(),
+          boxes(),
+          cached(false),
+          cacheMutex()
+    {
+        QMutexLocker locker(&curve.cacheMutex);
+        points = curve.points;
+        lengths = curve.lengths;
+        boxes = curve.boxes;
+        cached = curve.cached;
+    }
 
     virtual ~VAbstractCurveData();
 
@@ -86,6 +123,16 @@ class VAbstractCurveData : public QSharedData
     QString color;
     QString penStyle;
 
+    /** @brief points flattened curve. Filled on first request, cleared when the curve changes. */
+    mutable QVector<QPointF> points;
+    /** @brief lengths length along the flattened curve from the first point to each point. */
+    mutable QVector<qreal> lengths;
+    /** @brief boxes bounding box hierarchy over segments of the flattened curve. Built on first intersection query. */
+    mutable QVector<SegmentsBox> boxes;
+    mutable bool cached;
+    /** @brief cacheMutex guards the cache, copies of a curve share it and may be read on different threads. */
+    mutable QMutex cacheMutex;
+
 private:
     VAbstractCurveData &operator=(const VAbstractCurveData &) Q_DECL_EQ_DELETE;
 };
@@ -469,6 +469,7 @@ void VArc::SetFormulaRadius(const QString &formula, qreal value)
 {
     d->formulaRadius = formula;
     d->radius = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
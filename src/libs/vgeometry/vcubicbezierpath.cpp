@@ -162,6 +162,7 @@ VCubicBezierPath::~VCubicBezierPath()
 //---------------------------------------------------------------------------------------------------------------------
 VPointF &VCubicBezierPath::operator[](int indx)
 {
+    ResetCache();// Caller can change the point
     return d->path[indx];
 }
 
@@ -175,6 +176,7 @@ const VPointF &VCubicBezierPath::at(int indx) const
 void VCubicBezierPath::append(const VPointF &point)
 {
     d->path.append(point);
+    ResetCache();
     CreateName();
 }
 
@@ -194,6 +196,7 @@ qint32 VCubicBezierPath::CountPoints() const
 void VCubicBezierPath::Clear()
 {
     d->path.clear();
+    ResetCache();
     SetDuplicate(0);
 }
 
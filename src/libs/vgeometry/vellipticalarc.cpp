@@ -197,7 +197,7 @@ VEllipticalArc::~VEllipticalArc()
  */
 qreal VEllipticalArc::GetLength() const
 {
-    qreal length = PathLength(GetPoints());
+    qreal length = CachedLength();
 
     if (IsFlipped())
     {
@@ -237,6 +237,7 @@ QTransform VEllipticalArc::getTransform() const
 void VEllipticalArc::setTransform(const QTransform &matrix, bool combine)
 {
     d->m_transform = combine ? d->m_transform * matrix : matrix;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -513,6 +514,7 @@ void VEllipticalArc::SetFormulaRadius1(const QString &formula, qreal value)
 {
     d->formulaRadius1 = formula;
     d->radius1 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -520,6 +522,7 @@ void VEllipticalArc::SetFormulaRadius2(const QString &formula, qreal value)
 {
     d->formulaRadius2 = formula;
     d->radius2 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -527,6 +530,7 @@ void VEllipticalArc::SetFormulaRotationAngle(const QString &formula, qreal value
 {
     d->formulaRotationAngle = formula;
     d->rotationAngle = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
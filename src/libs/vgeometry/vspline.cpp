@@ -199,8 +199,7 @@ VSpline::~VSpline()
  */
 qreal VSpline::GetLength () const
 {
-    return LengthBezier ( static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()), static_cast<QPointF>(GetP3()),
-                          static_cast<QPointF>(GetP4()));
+    return CachedLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -284,6 +283,7 @@ VPointF VSpline::GetP1() const
 void VSpline::SetP1(const VPointF &p)
 {
     d->p1 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -324,6 +324,7 @@ VPointF VSpline::GetP4() const
 void VSpline::SetP4(const VPointF &p)
 {
     d->p4 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -363,6 +364,7 @@ void VSpline::SetStartAngle(qreal angle, const QString &formula)
 {
     d->angle1 = angle;
     d->angle1F = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -370,6 +372,7 @@ void VSpline::SetEndAngle(qreal angle, const QString &formula)
 {
     d->angle2 = angle;
     d->angle2F = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -401,6 +404,7 @@ void VSpline::SetC1Length(qreal length, const QString &formula)
 {
     d->c1Length = length;
     d->c1LengthF = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -408,6 +412,7 @@ void VSpline::SetC2Length(qreal length, const QString &formula)
 {
     d->c2Length = length;
     d->c2LengthF = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -181,14 +181,14 @@ class VAbstractPiece
     bool IsForbidFlipping() const;
     void SetForbidFlipping(bool value);
 
-    bool IsSeamAllowance() const;
-    void SetSeamAllowance(bool value);
+    bool         IsSeamAllowance() const;
+    virtual void SetSeamAllowance(bool value);
 
-    bool IsSeamAllowanceBuiltIn() const;
-    void SetSeamAllowanceBuiltIn(bool value);
+    bool         IsSeamAllowanceBuiltIn() const;
+    virtual void SetSeamAllowanceBuiltIn(bool value);
 
-    bool isHideSeamLine() const;
-    void setHideSeamLine(bool value);
+    bool         isHideSeamLine() const;
+    virtual void setHideSeamLine(bool value);
 
     qreal GetSAWidth() const;
     void  SetSAWidth(qreal value);
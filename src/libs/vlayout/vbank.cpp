@@ -51,6 +51,7 @@
 
 #include "vbank.h"
 
+#include <algorithm>
 #include <climits>
 
 #include "../vmisc/diagnostic.h"
@@ -76,8 +77,8 @@ QT_WARNING_POP
 //---------------------------------------------------------------------------------------------------------------------
 VBank::VBank()
     :details(QVector<VLayoutPiece>()), unsorted(QHash<int, qint64>()), big(QHash<int, qint64>()),
-      middle(QHash<int, qint64>()), small(QHash<int, qint64>()), layoutWidth(0), caseType(Cases::CaseDesc),
-      prepare(false), diagonal(0)
+      middle(QHash<int, qint64>()), small(QHash<int, qint64>()), layoutWidth(0), rotationIncrease(180),
+      caseType(Cases::CaseDesc), prepare(false), diagonal(0)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -100,6 +101,12 @@ void VBank::SetDetails(const QVector<VLayoutPiece> &details)
     Reset();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> VBank::GetDetails() const
+{
+    return details;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 int VBank::GetTiket()
 {
@@ -191,6 +198,24 @@ void VBank::NotArranged(int i)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TakeLeftDetails return indexes of all details not arranged yet in ascending order and mark them as
+ * arranged.
+ */
+QVector<int> VBank::TakeLeftDetails()
+{
+    QVector<int> left = (unsorted.keys() + big.keys() + middle.keys() + small.keys()).toVector();
+    std::sort(left.begin(), left.end());
+
+    unsorted.clear();
+    big.clear();
+    middle.clear();
+    small.clear();
+
+    return left;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VBank::Prepare()
 {
@@ -213,6 +238,7 @@ bool VBank::Prepare()
     {
         details[i].SetLayoutWidth(layoutWidth);
         details[i].SetLayoutAllowancePoints();
+        details[i].PrepareRotations(rotationIncrease);
 
         const qreal d = details.at(i).Diagonal();
         if (d > diagonal)
@@ -253,6 +279,21 @@ void VBank::SetCaseType(Cases caseType)
     this->caseType = caseType;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+Cases VBank::GetCaseType() const
+{
+    return caseType;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetRotationIncrease set step of rotation sweep that Prepare precomputes for every detail.
+ */
+void VBank::SetRotationIncrease(int increase)
+{
+    rotationIncrease = increase;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 int VBank::AllDetailsCount() const
 {
@@ -78,15 +78,19 @@ class VBank
     void SetLayoutWidth(const qreal &value);
 
     void SetDetails(const QVector<VLayoutPiece> &details);
+    QVector<VLayoutPiece> GetDetails() const;
     int  GetTiket();
     VLayoutPiece GetDetail(int i) const;
 
     void Arranged(int i);
     void NotArranged(int i);
+    QVector<int> TakeLeftDetails();
 
     bool Prepare();
     void Reset();
     void SetCaseType(Cases caseType);
+    Cases GetCaseType() const;
+    void SetRotationIncrease(int increase);
 
     int AllDetailsCount() const;
     int LeftArrange() const;
@@ -104,6 +108,7 @@ class VBank
     QHash<int, qint64> small;
 
     qreal layoutWidth;
+    int rotationIncrease;
 
     Cases caseType;
     bool prepare;
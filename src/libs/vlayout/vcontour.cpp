@@ -55,12 +55,11 @@
 #include <QPainterPath>
 #include <QPoint>
 #include <QPointF>
-#include <QPolygonF>
 #include <QRectF>
 #include <Qt>
 
 #include "vcontour_p.h"
-#include "vlayoutpiece.h"
+#include "vpolygoncollision.h"
 #include "../vmisc/vmath.h"
 
 #ifdef Q_COMPILER_RVALUE_REFS
@@ -104,6 +103,8 @@ VContour::~VContour()
 void VContour::SetContour(const QVector<QPointF> &contour)
 {
     d->globalContour = contour;
+    d->boundingRect = VPolygonCollision::BoundingRect(contour);
+    d->segmentGrid = VSegmentGrid(contour);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -155,12 +156,17 @@ QSizeF VContour::GetSize() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QVector<QPointF> VContour::UniteWithContour(const VLayoutPiece &detail, int globalI, int detJ, BestFrom type) const
+/**
+ * @brief UniteWithContour insert a placed detail into the global contour.
+ * @param layoutPoints transformed layout allowance points of the detail (see VLayoutPiece::getLayoutAllowancePoints).
+ */
+QVector<QPointF> VContour::UniteWithContour(const QVector<QPointF> &layoutPoints, int globalI, int detJ,
+                                            BestFrom type) const
 {
     QVector<QPointF> newContour;
     if (d->globalContour.isEmpty()) //-V807
     {
-        AppendWhole(newContour, detail, 0);
+        AppendWhole(newContour, layoutPoints, 0);
     }
     else
     {
@@ -169,7 +175,7 @@ QVector<QPointF> VContour::UniteWithContour(const VLayoutPiece &detail, int glob
             return QVector<QPointF>();
         }
 
-        if (detJ <= 0 || detJ > detail.LayoutEdgesCount())
+        if (detJ <= 0 || detJ > layoutPoints.count())
         {
             return QVector<QPointF>();
         }
@@ -191,12 +197,12 @@ QVector<QPointF> VContour::UniteWithContour(const VLayoutPiece &detail, int glob
             {
                 if (type == BestFrom::Rotation)
                 {
-                    AppendWhole(newContour, detail, detJ);
+                    AppendWhole(newContour, layoutPoints, detJ);
                 }
                 else
                 {
                     int processedEdges = 0;
-                    const int nD = detail.LayoutEdgesCount();
+                    const int nD = layoutPoints.count();
                     int j = detJ+1;
                     do
                     {
@@ -206,7 +212,7 @@ QVector<QPointF> VContour::UniteWithContour(const VLayoutPiece &detail, int glob
                         }
                         if (j != detJ)
                         {
-                            const QVector<QPointF> points = CutEdge(detail.LayoutEdge(j));
+                            const QVector<QPointF> points = CutEdge(PointsEdge(layoutPoints, j));
                             for (int i = 0; i < points.size()-1; ++i)
                             {
                                 newContour.append(points.at(i));
@@ -336,13 +342,13 @@ const QPointF &VContour::at(int i) const
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VContour::BoundingRect() const
 {
-    QVector<QPointF> points = GetContour();
-    if (points.isEmpty())
-    {
-        return QRectF();
-    }
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    return d->boundingRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+const VSegmentGrid &VContour::SegmentGrid() const
+{
+    return d->segmentGrid;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -363,10 +369,10 @@ QPainterPath VContour::ContourPath() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VContour::AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail, int detJ) const
+void VContour::AppendWhole(QVector<QPointF> &contour, const QVector<QPointF> &layoutPoints, int detJ) const
 {
     int processedEdges = 0;
-    const int nD = detail.LayoutEdgesCount();
+    const int nD = layoutPoints.count();
     int j = detJ+1;
     do
     {
@@ -374,7 +380,7 @@ void VContour::AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail
         {
             j=1;
         }
-        const QVector<QPointF> points = CutEdge(detail.LayoutEdge(j));
+        const QVector<QPointF> points = CutEdge(PointsEdge(layoutPoints, j));
         for (int i = 0; i < points.size()-1; ++i)
         {
             contour.append(points.at(i));
@@ -384,6 +390,17 @@ void VContour::AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail
     }while (processedEdges < nD);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PointsEdge return edge i (counting from 1) of closed polygon. Same as VLayoutPiece::LayoutEdge for transformed
+ * points.
+ */
+QLineF VContour::PointsEdge(const QVector<QPointF> &points, int i)
+{
+    const int i2 = i < points.count() ? i : 0;
+    return QLineF(points.at(i-1), points.at(i2));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VContour::EmptySheetEdge() const
 {
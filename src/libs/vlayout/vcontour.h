@@ -65,7 +65,7 @@ class QPointF;
 class QLineF;
 class QRectF;
 class QPainterPath;
-class VLayoutPiece;
+class VSegmentGrid;
 
 class VContour
 {
@@ -97,7 +97,8 @@ class VContour
 
     QSizeF GetSize() const;
 
-    QVector<QPointF> UniteWithContour(const VLayoutPiece &detail, int globalI, int detJ, BestFrom type) const;
+    QVector<QPointF> UniteWithContour(const QVector<QPointF> &layoutPoints, int globalI, int detJ,
+                                      BestFrom type) const;
 
     QLineF EmptySheetEdge() const;
     int    GlobalEdgesCount() const;
@@ -108,13 +109,15 @@ class VContour
     const QPointF &	at(int i) const;
 
     QRectF BoundingRect() const;
+    const VSegmentGrid &SegmentGrid() const;
 
     QPainterPath ContourPath() const;
 
 private:
     QSharedDataPointer<VContourData> d;
 
-    void AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail, int detJ) const;
+    void AppendWhole(QVector<QPointF> &contour, const QVector<QPointF> &layoutPoints, int detJ) const;
+    static QLineF PointsEdge(const QVector<QPointF> &points, int i);
 };
 
 Q_DECLARE_TYPEINFO(VContour, Q_MOVABLE_TYPE);
@@ -54,8 +54,10 @@
 
 #include <QSharedData>
 #include <QPointF>
+#include <QRectF>
 
 #include "../vmisc/diagnostic.h"
+#include "vsegmentgrid.h"
 
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
@@ -65,16 +67,18 @@ class VContourData : public QSharedData
 {
 public:
     VContourData()
-        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0), boundingRect(), segmentGrid()
     {}
 
     VContourData(int height, int width)
-        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0), boundingRect(),
+          segmentGrid()
     {}
 
     VContourData(const VContourData &contour)
         :QSharedData(contour), globalContour(contour.globalContour), paperHeight(contour.paperHeight),
-          paperWidth(contour.paperWidth), shift(contour.shift)
+          paperWidth(contour.paperWidth), shift(contour.shift), boundingRect(contour.boundingRect),
+          segmentGrid(contour.segmentGrid)
     {}
 
     ~VContourData() {}
@@ -90,6 +94,12 @@ class VContourData : public QSharedData
 
     quint32 shift;
 
+    /** @brief boundingRect bounding rect of global contour. Updated together with contour. */
+    QRectF boundingRect;
+
+    /** @brief segmentGrid spatial index over global contour edges. Updated together with contour. */
+    VSegmentGrid segmentGrid;
+
 private:
     VContourData &operator=(const VContourData &) Q_DECL_EQ_DELETE;
 };
@@ -20,7 +20,11 @@ HEADERS += \
     $$PWD/vlayoutpiece.h \
     $$PWD/vlayoutpiece_p.h \
     $$PWD/vlayoutpiecepath.h \
-    $$PWD/vlayoutpiecepath_p.h
+    $$PWD/vlayoutpiecepath_p.h \
+    $$PWD/vpolygoncollision.h \
+    $$PWD/vsegmentgrid.h \
+    $$PWD/vlayoutpose.h \
+    $$PWD/vlayoutrotations.h
 
 SOURCES += \
     $$PWD/vlayoutgenerator.cpp \
@@ -34,6 +38,10 @@ SOURCES += \
     $$PWD/vgraphicsfillitem.cpp \
     $$PWD/vabstractpiece.cpp \
     $$PWD/vlayoutpiece.cpp \
-    $$PWD/vlayoutpiecepath.cpp
+    $$PWD/vlayoutpiecepath.cpp \
+    $$PWD/vpolygoncollision.cpp \
+    $$PWD/vsegmentgrid.cpp \
+    $$PWD/vlayoutpose.cpp \
+    $$PWD/vlayoutrotations.cpp
 
 *msvc*:SOURCES += $$PWD/stable.cpp
@@ -51,15 +51,107 @@
 
 #include "vlayoutgenerator.h"
 
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QGraphicsRectItem>
 #include <QRectF>
+#include <QRunnable>
 #include <QThreadPool>
+#include <QTimer>
+#include <algorithm>
+#include <functional>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Runs one layout attempt on a thread of the attempts pool.
+class VAttemptRunnable : public QRunnable
+{
+public:
+    explicit VAttemptRunnable(const std::function<void()> &job)
+        : QRunnable(),
+          job(job)
+    {}
+
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        job();
+    }
+
+private:
+    Q_DISABLE_COPY(VAttemptRunnable)
+    std::function<void()> job;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Next smaller step that still divides full circle.
+int FinerRotationIncrease(int increase)
+{
+    for (int i = increase - 1; i >= 1; --i)
+    {
+        if (360 % i == 0)
+        {
+            return i;
+        }
+    }
+    return increase;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Less sheets is better, then less area covered by bounding rects of arranged details.
+bool IsBetterLayout(const QVector<VLayoutPaper> &papers, const QVector<VLayoutPaper> &best)
+{
+    if (best.isEmpty())
+    {
+        return not papers.isEmpty();
+    }
+
+    if (papers.isEmpty() || papers.size() != best.size())
+    {
+        return not papers.isEmpty() && papers.size() < best.size();
+    }
+
+    qreal area = 0;
+    qreal bestArea = 0;
+    for (int i = 0; i < papers.size(); ++i)
+    {
+        const QRectF rect = papers.at(i).DetailsBoundingRect();
+        area += rect.width() * rect.height();
+
+        const QRectF bestRect = best.at(i).DetailsBoundingRect();
+        bestArea += bestRect.width() * bestRect.height();
+    }
+    return area < bestArea;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// State of one independent layout attempt.
+struct VLayoutAttempt
+{
+    VLayoutAttempt()
+        : bank(),
+          rotationIncrease(180),
+          papers(),
+          state(LayoutErrors::NoError),
+          arranged(0)
+    {}
+
+    VBank                 bank;
+    int                   rotationIncrease;
+    QVector<VLayoutPaper> papers;
+    LayoutErrors          state;
+    std::atomic_int       arranged;
+
+private:
+    Q_DISABLE_COPY(VLayoutAttempt)
+};
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::VLayoutGenerator(QObject *parent)
     : QObject(parent),
@@ -85,7 +177,17 @@ VLayoutGenerator::VLayoutGenerator(QObject *parent)
       stripOptimizationEnabled(false),
       multiplier(1),
       stripOptimization(false),
-      textAsPaths(false)
+      textAsPaths(false),
+      attempts(1),
+      timeBudget(0),
+#ifdef Q_CC_MSVC
+      timedOut(ATOMIC_VAR_INIT(false)),
+#else
+      timedOut(false),
+#endif
+      placementCount(0),
+      placementTime(0),
+      crossingCount(0)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -123,8 +225,12 @@ int VLayoutGenerator::DetailsCount()
 void VLayoutGenerator::Generate()
 {
     stopGeneration.store(false);
+    timedOut.store(false);
     papers.clear();
     state = LayoutErrors::NoError;
+    placementCount = 0;
+    placementTime = 0;
+    crossingCount = 0;
 
 #ifdef LAYOUT_DEBUG
     const QString path = QDir::homePath()+QStringLiteral("/LayoutDebug");
@@ -135,6 +241,20 @@ void VLayoutGenerator::Generate()
 
     emit Start();
 
+    // Fires from event processing while waiting for candidates. Stops the search, but unlike Abort() keeps the result.
+    QTimer budget;
+    budget.setSingleShot(true);
+    connect(&budget, &QTimer::timeout, this, [this]()
+    {
+        timedOut.store(true);
+        stopGeneration.store(true);
+    });
+    if (timeBudget > 0)
+    {
+        budget.start(timeBudget);
+    }
+
+    bank->SetRotationIncrease(rotationIncrease);
     if (bank->Prepare())
     {
         const int width = PageWidth();
@@ -151,74 +271,319 @@ void VLayoutGenerator::Generate()
             }
         }
 
-        while (bank->AllDetailsCount() > 0)
+        const LayoutErrors result = attempts > 1 ? ArrangeAttempts(height, width)
+                                                 : ArrangeSheets(*bank, rotationIncrease, height, width, papers);
+        if (result != LayoutErrors::NoError)
         {
-            if (stopGeneration.load())
-            {
-                break;
-            }
+            state = result;
+            emit Error(state);
+            return;
+        }
+    }
+    else
+    {
+        state = LayoutErrors::PrepareLayoutError;
+        emit Error(state);
+        return;
+    }
+
+    if (stripOptimizationEnabled)
+    {
+        GatherPages();
+    }
+
+    if (IsUnitePages())
+    {
+        UnitePages();
+    }
+
+    emit Finished();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangeSheets fill sheets one after another with details from the prepared bank.
+ * @param arranged if not null receives count of arranged details instead of signal Arranged. Attempts running in
+ * parallel report progress this way.
+ */
+LayoutErrors VLayoutGenerator::ArrangeSheets(VBank &bank, int increase, int height, int width,
+                                             QVector<VLayoutPaper> &papers, std::atomic_int *arranged)
+{
+    while (bank.AllDetailsCount() > 0)
+    {
+        if (stopGeneration.load())
+        {
+            break;
+        }
 
-            VLayoutPaper paper(height, width);
-            paper.SetShift(shift);
-            paper.SetLayoutWidth(bank->GetLayoutWidth());
-            paper.SetPaperIndex(static_cast<quint32>(papers.count()));
-            paper.SetRotate(rotate);
-            paper.SetRotationIncrease(rotationIncrease);
-            paper.SetSaveLength(saveLength);
-            do
+        VLayoutPaper paper = CreatePaper(bank, increase, height, width, papers.count());
+        do
+        {
+            const int index = bank.GetTiket();
+            QElapsedTimer timer;
+            timer.start();
+            const bool isArranged = paper.ArrangeDetail(bank.GetDetail(index), stopGeneration);
+            placementTime += timer.nsecsElapsed();
+            ++placementCount;
+
+            if (isArranged)
             {
-                const int index = bank->GetTiket();
-                if (paper.ArrangeDetail(bank->GetDetail(index), stopGeneration))
+                bank.Arranged(index);
+                if (arranged != nullptr)
                 {
-                    bank->Arranged(index);
-                    emit Arranged(bank->ArrangedCount());
+                    arranged->store(bank.ArrangedCount());
                 }
                 else
                 {
-                    bank->NotArranged(index);
-                }
-
-                if (stopGeneration.load())
-                {
-                    break;
+                    emit Arranged(bank.ArrangedCount());
                 }
-            } while(bank->LeftArrange() > 0);
+            }
+            else
+            {
+                bank.NotArranged(index);
+            }
 
             if (stopGeneration.load())
             {
                 break;
             }
+        } while(bank.LeftArrange() > 0);
 
-            if (paper.Count() > 0)
+        crossingCount += paper.CrossingCount();
+
+        if (stopGeneration.load())
+        {
+            if (timedOut.load() && paper.Count() > 0)
             {
                 papers.append(paper);
             }
-            else
+            break;
+        }
+
+        if (paper.Count() > 0)
+        {
+            papers.append(paper);
+        }
+        else
+        {
+            return LayoutErrors::EmptyPaperError;
+        }
+    }
+
+    if (timedOut.load())
+    {
+        return PlaceLeftDetails(bank, increase, height, width, papers, arranged);
+    }
+    return LayoutErrors::NoError;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PlaceLeftDetails put details left after the time budget is over in rows without searching a position.
+ *
+ * Rows go from the top of a sheet to the bottom, the tallest details first. The first row starts below details of the
+ * last sheet, so the sheet filled when time was over is used to the end.
+ */
+LayoutErrors VLayoutGenerator::PlaceLeftDetails(VBank &bank, int increase, int height, int width,
+                                                QVector<VLayoutPaper> &papers, std::atomic_int *arranged)
+{
+    QVector<int> left = bank.TakeLeftDetails();
+    if (left.isEmpty())
+    {
+        return LayoutErrors::NoError;
+    }
+
+    // Ties are broken by index to get the same layout on every run.
+    std::stable_sort(left.begin(), left.end(), [&bank](int i1, int i2)
+    {
+        const qreal h1 = bank.GetDetail(i1).LayoutBoundingRect().height();
+        const qreal h2 = bank.GetDetail(i2).LayoutBoundingRect().height();
+        if (h1 > h2 || h1 < h2)
+        {
+            return h1 > h2;
+        }
+        return i1 < i2;
+    });
+
+    QVector<VLayoutPiece> details;
+    details.reserve(left.size());
+    for (int i = 0; i < left.size(); ++i)
+    {
+        details.append(bank.GetDetail(left.at(i)));
+    }
+
+    VLayoutPaper paper;
+    QList<VLayoutPiece> placed;
+    qreal x = 0;
+    qreal y = 0;
+    qreal rowHeight = 0;
+
+    if (not papers.isEmpty())
+    {
+        paper = papers.takeLast();
+        placed = paper.GetDetails().toList();
+        y = paper.DetailsBoundingRect().bottom() + bank.GetLayoutWidth();
+    }
+    else
+    {
+        paper = CreatePaper(bank, increase, height, width, 0);
+    }
+
+    for (int i = 0; i < details.size(); ++i)
+    {
+        VLayoutPiece detail = details.at(i);
+        const QRectF rect = detail.LayoutBoundingRect();
+        if (rect.width() > width || rect.height() > height)
+        {
+            return LayoutErrors::EmptyPaperError;
+        }
+
+        if (x + rect.width() > width)
+        {
+            x = 0;
+            y += rowHeight;
+            rowHeight = 0;
+        }
+
+        if (y + rect.height() > height)
+        {
+            paper.SetDetails(placed);
+            papers.append(paper);
+
+            paper = CreatePaper(bank, increase, height, width, papers.count());
+            placed.clear();
+            x = 0;
+            y = 0;
+            rowHeight = 0;
+        }
+
+        detail.Translate(x - rect.x(), y - rect.y());
+        placed.append(detail);
+
+        x += rect.width();
+        rowHeight = qMax(rowHeight, rect.height());
+    }
+
+    paper.SetDetails(placed);
+    papers.append(paper);
+
+    if (arranged != nullptr)
+    {
+        arranged->store(bank.ArrangedCount());
+    }
+    else
+    {
+        emit Arranged(bank.ArrangedCount());
+    }
+    return LayoutErrors::NoError;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPaper VLayoutGenerator::CreatePaper(const VBank &bank, int increase, int height, int width, int index) const
+{
+    VLayoutPaper paper(height, width);
+    paper.SetShift(shift);
+    paper.SetLayoutWidth(bank.GetLayoutWidth());
+    paper.SetPaperIndex(static_cast<quint32>(index));
+    paper.SetRotate(rotate);
+    paper.SetRotationIncrease(increase);
+    paper.SetSaveLength(saveLength);
+    return paper;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangeAttempts run several independent layouts at the same time and keep the best one.
+ *
+ * The first attempt uses the settings as is. Next attempts go through the other groupping cases (detail orderings), and
+ * every full round of cases uses a finer rotation step. Attempts run on their own pool, so waiting for candidates
+ * inside an attempt never blocks the global pool that checks candidates.
+ */
+LayoutErrors VLayoutGenerator::ArrangeAttempts(int height, int width)
+{
+    const QVector<Cases> cases = QVector<Cases>() << Cases::CaseThreeGroup << Cases::CaseTwoGroup << Cases::CaseDesc;
+    const int firstCase = qMax(0, cases.indexOf(bank->GetCaseType()));
+
+    QVector<VLayoutAttempt *> tries;
+    int increase = rotationIncrease;
+    for (int i = 0; i < attempts; ++i)
+    {
+        if (i > 0 && i % cases.size() == 0)
+        {
+            increase = FinerRotationIncrease(increase);
+        }
+
+        VLayoutAttempt *attempt = new VLayoutAttempt();
+        attempt->rotationIncrease = increase;
+        attempt->bank.SetDetails(bank->GetDetails());
+        attempt->bank.SetLayoutWidth(bank->GetLayoutWidth());
+        attempt->bank.SetCaseType(cases.at((firstCase + i) % cases.size()));
+        attempt->bank.SetRotationIncrease(increase);
+        tries.append(attempt);
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(tries.size());
+    for (int i = 0; i < tries.size(); ++i)
+    {
+        VLayoutAttempt *attempt = tries.at(i);
+        pool.start(new VAttemptRunnable([this, attempt, height, width]()
+        {
+            if (not attempt->bank.Prepare())
             {
-                state = LayoutErrors::EmptyPaperError;
-                emit Error(state);
+                attempt->state = LayoutErrors::PrepareLayoutError;
                 return;
             }
-        }
+            attempt->state = ArrangeSheets(attempt->bank, attempt->rotationIncrease, height, width, attempt->papers,
+                                           &attempt->arranged);
+        }));
     }
-    else
+
+    int reported = 0;
+    while (not pool.waitForDone(50))
     {
-        state = LayoutErrors::PrepareLayoutError;
-        emit Error(state);
-        return;
+        QCoreApplication::processEvents();
+
+        int arranged = 0;
+        for (int i = 0; i < tries.size(); ++i)
+        {
+            arranged = qMax(arranged, tries.at(i)->arranged.load());
+        }
+
+        if (arranged > reported)
+        {
+            reported = arranged;
+            emit Arranged(reported);
+        }
     }
 
-    if (stripOptimizationEnabled)
+    LayoutErrors result = LayoutErrors::EmptyPaperError;
+    int best = -1;
+    for (int i = 0; i < tries.size(); ++i)
     {
-        GatherPages();
+        if (tries.at(i)->state != LayoutErrors::NoError)
+        {
+            continue;
+        }
+
+        if (best < 0 || IsBetterLayout(tries.at(i)->papers, tries.at(best)->papers))
+        {
+            best = i;
+        }
     }
 
-    if (IsUnitePages())
+    if (best >= 0)
     {
-        UnitePages();
+        papers = tries.at(best)->papers;
+        result = LayoutErrors::NoError;
+    }
+    else if (not tries.isEmpty())
+    {
+        result = tries.first()->state;
     }
 
-    emit Finished();
+    qDeleteAll(tries.begin(), tries.end());
+    return result;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -263,9 +628,76 @@ QVector<QVector<VLayoutPiece> > VLayoutGenerator::GetAllDetails() const
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::Abort()
 {
+    // Don't clear the thread pool. A paper waits for all its candidates and cancels those not started yet itself.
     stopGeneration.store(true);
     state = LayoutErrors::ProcessStoped;
-    QThreadPool::globalInstance()->clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PlacementCount return number of placement attempts (one per ArrangeDetail call) made by last generation.
+ */
+int VLayoutGenerator::PlacementCount() const
+{
+    return placementCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PlacementTime return total time in nanoseconds spent on placement attempts by last generation.
+ */
+qint64 VLayoutGenerator::PlacementTime() const
+{
+    return placementTime;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CrossingCount return number of polygon collision tests made by last generation.
+ */
+qint64 VLayoutGenerator::CrossingCount() const
+{
+    return crossingCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutGenerator::GetAttempts() const
+{
+    return attempts;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetAttempts set count of independent layouts to try at the same time. The best of them wins. 1 disables
+ * parallel attempts.
+ */
+void VLayoutGenerator::SetAttempts(int value)
+{
+    attempts = qMax(1, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutGenerator::GetTimeBudget() const
+{
+    return timeBudget;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetTimeBudget set time limit for generation in milliseconds. 0 means no limit.
+ */
+void VLayoutGenerator::SetTimeBudget(int msec)
+{
+    timeBudget = qMax(0, msec);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsTimedOut return true if last generation ran out of time and remaining details were put in rows.
+ */
+bool VLayoutGenerator::IsTimedOut() const
+{
+    return timedOut.load();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -128,6 +128,17 @@ class VLayoutGenerator :public QObject
     bool IsTestAsPaths() const;
     void SetTestAsPaths(bool value);
 
+    int  GetAttempts() const;
+    void SetAttempts(int value);
+
+    int  GetTimeBudget() const;
+    void SetTimeBudget(int msec);
+    bool IsTimedOut() const;
+
+    int    PlacementCount() const;
+    qint64 PlacementTime() const;
+    qint64 CrossingCount() const;
+
 signals:
     void Start();
     void Arranged(int count);
@@ -157,10 +168,23 @@ public slots:
     quint8 multiplier;
     bool stripOptimization;
     bool textAsPaths;
+    int attempts;
+    int timeBudget;
+    std::atomic_bool timedOut;
+    std::atomic_int placementCount;
+    std::atomic<qint64> placementTime;
+    std::atomic<qint64> crossingCount;
 
     int PageHeight() const;
     int PageWidth() const;
 
+    LayoutErrors ArrangeSheets(VBank &bank, int increase, int height, int width, QVector<VLayoutPaper> &papers,
+                               std::atomic_int *arranged = nullptr);
+    LayoutErrors ArrangeAttempts(int height, int width);
+    LayoutErrors PlaceLeftDetails(VBank &bank, int increase, int height, int width, QVector<VLayoutPaper> &papers,
+                                  std::atomic_int *arranged);
+    VLayoutPaper CreatePaper(const VBank &bank, int increase, int height, int width, int index) const;
+
     void GatherPages();
     void UnitePages();
     void UniteDetails(int j, QList<QList<VLayoutPiece> > &nDetails, qreal length, int i);
@@ -60,7 +60,7 @@
 #include <QPointF>
 #include <QRect>
 #include <QRectF>
-#include <QThread>
+#include <QSemaphore>
 #include <QThreadPool>
 #include <QVector>
 #include <Qt>
@@ -248,6 +248,15 @@ int VLayoutPaper::Count() const
     return d->details.count();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CrossingCount return number of polygon collision tests made by all candidates of this paper.
+ */
+qint64 VLayoutPaper::CrossingCount() const
+{
+    return d->crossingCount;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VLayoutPaper::AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop)
 {
@@ -255,6 +264,7 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop
     QThreadPool *thread_pool = QThreadPool::globalInstance();
     thread_pool->setExpiryTimeout(1000);
     QVector<VPosition *> threads;
+    QSemaphore finished; // Each candidate releases one resource when done
 
     int detailEdgesCount = 0;
 
@@ -267,36 +277,35 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop
         detailEdgesCount = detail.LayoutEdgesCount();
     }
 
-    for (int j=1; j <= d->globalContour.GlobalEdgesCount(); ++j)
-    {
-        for (int i=1; i<= detailEdgesCount; ++i)
-        {
-            VPosition *thread = new VPosition(d->globalContour, j, detail, i, &stop, d->localRotate,
-                                              d->localRotationIncrease,
-                                              d->saveLength);
-            //Info for debug
-            #ifdef LAYOUT_DEBUG
-                thread->setPaperIndex(d->paperIndex);
-                thread->setFrame(d->frame);
-                thread->setDetailsCount(d->details.count());
-                thread->setDetails(d->details);
-            #endif
-
-            thread->setAutoDelete(false);
-            threads.append(thread);
-            thread_pool->start(thread);
-
-            d->frame = d->frame + 3 + static_cast<quint32>(360/d->localRotationIncrease*2);
-        }
-    }
+    // Split edge pairs (global edge x detail edge) into batches. Several batches per worker keep the load balanced
+    // while the number of tasks stays small.
+    const int pairsCount = d->globalContour.GlobalEdgesCount() * detailEdgesCount;
+    const int batchesCount = qBound(1, thread_pool->maxThreadCount() * 4, pairsCount);
+    const int batchSize = (pairsCount + batchesCount - 1) / batchesCount;
+    const quint32 pairFrames = 3 + static_cast<quint32>(360/d->localRotationIncrease*2);
 
-    // Wait for done
-    do
+    for (int firstPair = 0; firstPair < pairsCount; firstPair += batchSize)
     {
-        QCoreApplication::processEvents();
-        QThread::msleep(250);
+        const int lastPair = qMin(firstPair + batchSize, pairsCount);
+
+        VPosition *thread = new VPosition(d->globalContour, detail, detailEdgesCount, firstPair, lastPair, &stop,
+                                          d->localRotate, d->localRotationIncrease, d->saveLength, &finished);
+        //Info for debug
+        #ifdef LAYOUT_DEBUG
+            thread->setPaperIndex(d->paperIndex);
+            thread->setFrame(d->frame);
+            thread->setDetailsCount(d->details.count());
+            thread->setDetails(d->details);
+        #endif
+
+        thread->setAutoDelete(false);
+        threads.append(thread);
+        thread_pool->start(thread);
+
+        d->frame = d->frame + static_cast<quint32>(lastPair - firstPair) * pairFrames;
     }
-    while(thread_pool->activeThreadCount() > 0 && not stop.load());
+
+    WaitForCandidates(threads, finished, stop);
 
     if (stop.load())
     {
@@ -305,9 +314,11 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop
         return false;
     }
 
+    // Merge results of batches
     for (int i=0; i < threads.size(); ++i)
     {
         bestResult.NewResult(threads.at(i)->getBestResult());
+        d->crossingCount += threads.at(i)->getCrossingCount();
     }
 
     qDeleteAll(threads.begin(), threads.end());
@@ -316,6 +327,35 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop
     return SaveResult(bestResult, detail);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WaitForCandidates blocks until all candidates have finished. We wake up as soon as the last one releases the
+ * semaphore, the timeout only defines how often the event loop gets a chance to update the progress dialog.
+ */
+void VLayoutPaper::WaitForCandidates(const QVector<VPosition *> &threads, QSemaphore &finished,
+                                     std::atomic_bool &stop)
+{
+    QThreadPool *thread_pool = QThreadPool::globalInstance();
+    bool canceled = false;
+    while (not finished.tryAcquire(threads.size(), 50))
+    {
+        QCoreApplication::processEvents();
+
+        if (stop.load() && not canceled)
+        {
+            // Candidates that haven't started yet will never run, release their share ourselves.
+            for (int i=0; i < threads.size(); ++i)
+            {
+                if (thread_pool->tryTake(threads.at(i)))
+                {
+                    finished.release();
+                }
+            }
+            canceled = true;
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VLayoutPaper::SaveResult(const VBestSquare &bestResult, const VLayoutPiece &detail)
 {
@@ -324,9 +364,9 @@ bool VLayoutPaper::SaveResult(const VBestSquare &bestResult, const VLayoutPiece
         VLayoutPiece workDetail = detail;
         workDetail.setTransform(bestResult.Transform());// Don't forget set transform
         workDetail.SetMirror(bestResult.isMirror());
-        const QVector<QPointF> newGContour = d->globalContour.UniteWithContour(workDetail, bestResult.GContourEdge(),
-                                                                               bestResult.DetailEdge(),
-                                                                               bestResult.Type());
+        const QVector<QPointF> newGContour =
+                d->globalContour.UniteWithContour(workDetail.getLayoutAllowancePoints(), bestResult.GContourEdge(),
+                                                  bestResult.DetailEdge(), bestResult.Type());
         if (newGContour.isEmpty())
         {
             return false;
@@ -63,7 +63,9 @@
 class VBestSquare;
 class VLayoutPaperData;
 class VLayoutPiece;
+class VPosition;
 class QGraphicsRectItem;
+class QSemaphore;
 class QRectF;
 class QGraphicsItem;
 template <typename T> class QList;
@@ -110,6 +112,7 @@ class VLayoutPaper
 
     bool ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop);
     int  Count() const;
+    qint64 CrossingCount() const;
     Q_REQUIRED_RESULT QGraphicsRectItem *GetPaperItem(bool autoCrop, bool textAsPaths) const;
     Q_REQUIRED_RESULT QList<QGraphicsItem *> GetItemDetails(bool textAsPaths) const;
 
@@ -122,6 +125,7 @@ class VLayoutPaper
     QSharedDataPointer<VLayoutPaperData> d;
 
     bool AddToSheet(const VLayoutPiece &detail, std::atomic_bool &stop);
+    static void WaitForCandidates(const QVector<VPosition *> &threads, QSemaphore &finished, std::atomic_bool &stop);
 
     bool SaveResult(const VBestSquare &bestResult, const VLayoutPiece &detail);
 
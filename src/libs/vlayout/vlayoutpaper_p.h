@@ -76,7 +76,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          crossingCount(0)
     {}
 
     VLayoutPaperData(int height,
@@ -90,7 +91,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          crossingCount(0)
     {}
 
     VLayoutPaperData(const VLayoutPaperData &paper)
@@ -104,7 +106,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(paper.localRotate),
           globalRotationIncrease(paper.globalRotationIncrease),
           localRotationIncrease(paper.localRotationIncrease),
-          saveLength(paper.saveLength)
+          saveLength(paper.saveLength),
+          crossingCount(paper.crossingCount)
     {}
 
     ~VLayoutPaperData() {}
@@ -124,6 +127,9 @@ class VLayoutPaperData : public QSharedData
     int localRotationIncrease;
     bool saveLength;
 
+    /** @brief crossingCount number of polygon collision tests made while arranging details. */
+    qint64 crossingCount;
+
 private:
     VLayoutPaperData& operator=(const VLayoutPaperData&) Q_DECL_EQ_DELETE;
 };
@@ -472,6 +472,7 @@ void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMa
 {
     d->contour = RemoveDublicates(points, false);
     setHideSeamLine(hideMainPath);
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -499,12 +500,65 @@ void VLayoutPiece::setSeamAllowancePoints(const QVector<QPointF> &points, bool s
             SetSeamAllowance(false);
         }
     }
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::SetSeamAllowance(bool value)
+{
+    VAbstractPiece::SetSeamAllowance(value);
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::SetSeamAllowanceBuiltIn(bool value)
+{
+    VAbstractPiece::SetSeamAllowanceBuiltIn(value);
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::setHideSeamLine(bool value)
+{
+    VAbstractPiece::setHideSeamLine(value);
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VLayoutPiece::getLayoutAllowancePoints() const
 {
-    return Map(d->layoutAllowance);
+    QMutexLocker locker(&d->cacheMutex);
+    if (not d->layoutAllowanceCached)
+    {
+        d->mappedLayoutAllowance = Map(d->layoutAllowance);
+        d->layoutAllowanceCached = true;
+    }
+    return d->mappedLayoutAllowance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareRotations precompute rotation sweep with step increase for the current position of the detail.
+ * The sweep is dropped on any change of transform or points.
+ */
+void VLayoutPiece::PrepareRotations(int increase)
+{
+    d->rotations = VLayoutRotations(DetailPath(), d->layoutAllowance, d->transform, increase);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+const VLayoutRotations &VLayoutPiece::Rotations() const
+{
+    return d->rotations;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getLayoutAllowance return not transformed layout allowance points.
+ */
+QVector<QPointF> VLayoutPiece::getLayoutAllowance() const
+{
+    return d->layoutAllowance;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -696,6 +750,7 @@ QTransform VLayoutPiece::getTransform() const
 void VLayoutPiece::setTransform(const QTransform &transform)
 {
     d->transform = transform;
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -713,19 +768,15 @@ void VLayoutPiece::SetLayoutWidth(const qreal &value)
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::Translate(qreal dx, qreal dy)
 {
-    QTransform m;
-    m.translate(dx, dy);
-    d->transform *= m;
+    d->transform *= QTransform::fromTranslate(dx, dy);
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::Rotate(const QPointF &originPoint, qreal degrees)
 {
-    QTransform m;
-    m.translate(originPoint.x(), originPoint.y());
-    m.rotate(-degrees);
-    m.translate(-originPoint.x(), -originPoint.y());
-    d->transform *= m;
+    d->transform *= RotationTransform(originPoint, degrees);
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -736,29 +787,42 @@ void VLayoutPiece::Mirror(const QLineF &edge)
         return;
     }
 
+    d->transform *= MirrorTransform(edge);
+    d->mirror = !d->mirror;
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QTransform VLayoutPiece::RotationTransform(const QPointF &originPoint, qreal degrees)
+{
+    QTransform m;
+    m.translate(originPoint.x(), originPoint.y());
+    m.rotate(-degrees);
+    m.translate(-originPoint.x(), -originPoint.y());
+    return m;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MirrorTransform reflection over the line of edge. Rotate edge to Ox axis around p2, flip, and rotate back.
+ */
+QTransform VLayoutPiece::MirrorTransform(const QLineF &edge)
+{
     const QLineF axis = QLineF(edge.x2(), edge.y2(), edge.x2() + 100, edge.y2()); // Ox axis
 
     const qreal angle = edge.angleTo(axis);
     const QPointF p2 = edge.p2();
-    QTransform m;
-    m.translate(p2.x(), p2.y());
-    m.rotate(-angle);
-    m.translate(-p2.x(), -p2.y());
-    d->transform *= m;
-
-    m.reset();
-    m.translate(p2.x(), p2.y());
-    m.scale(m.m11(), m.m22()*-1);
-    m.translate(-p2.x(), -p2.y());
-    d->transform *= m;
-
-    m.reset();
-    m.translate(p2.x(), p2.y());
-    m.rotate(-(360-angle));
-    m.translate(-p2.x(), -p2.y());
-    d->transform *= m;
 
-    d->mirror = !d->mirror;
+    QTransform m = RotationTransform(p2, angle);
+
+    QTransform flip;
+    flip.translate(p2.x(), p2.y());
+    flip.scale(1, -1);
+    flip.translate(-p2.x(), -p2.y());
+    m *= flip;
+
+    m *= RotationTransform(p2, 360-angle);
+    return m;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -776,50 +840,49 @@ int VLayoutPiece::LayoutEdgesCount() const
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::DetailEdge(int i) const
 {
-    return Edge(DetailPath(), i);
+    return MappedEdge(DetailPath(), i, d->transform, d->mirror);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::LayoutEdge(int i) const
 {
-    return Edge(d->layoutAllowance, i);
+    return MappedEdge(d->layoutAllowance, i, d->transform, d->mirror);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::DetailEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(DetailPath(), p1);
+    return EdgeByPoint(Map(DetailPath()), p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::LayoutEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(d->layoutAllowance, p1);
+    return EdgeByPoint(getLayoutAllowancePoints(), p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::DetailBoundingRect() const
 {
-    QVector<QPointF> points;
-    if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
+    QMutexLocker locker(&d->cacheMutex);
+    if (not d->detailBoundingRectCached)
     {
-        points = GetSeamAllowancePoints();
+        d->detailBoundingRect = MappedBoundingRect(DetailPath(), d->transform);
+        d->detailBoundingRectCached = true;
     }
-    else
-    {
-        points = getContourPoints();
-    }
-
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    return d->detailBoundingRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::LayoutBoundingRect() const
 {
-    QVector<QPointF> points = getLayoutAllowancePoints();
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    QMutexLocker locker(&d->cacheMutex);
+    if (not d->layoutBoundingRectCached)
+    {
+        d->layoutBoundingRect = MappedBoundingRect(d->layoutAllowance, d->transform);
+        d->layoutBoundingRectCached = true;
+    }
+    return d->layoutBoundingRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -889,6 +952,7 @@ void VLayoutPiece::SetLayoutAllowancePoints()
     {
         d->layoutAllowance.clear();
     }
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -950,22 +1014,48 @@ void VLayoutPiece::setCutoutPaths(const QVector<VLayoutPiecePath> &cutoutPaths)
 template <class T>
 QVector<T> VLayoutPiece::Map(const QVector<T> &points) const
 {
-    QVector<T> p;
-    for (int i = 0; i < points.size(); ++i)
+    return MapPoints(points, d->transform, d->mirror);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedBoundingRect bounding rect of transformed points. Doesn't create a copy of points.
+ */
+QRectF VLayoutPiece::MappedBoundingRect(const QVector<QPointF> &points, const QTransform &transform)
+{
+    if (points.isEmpty())
     {
-        p.append(d->transform.map(points.at(i)));
+        return QRectF();
     }
 
-    if (d->mirror)
+    const QPointF first = transform.map(points.at(0));
+    qreal minX = first.x();
+    qreal minY = first.y();
+    qreal maxX = minX;
+    qreal maxY = minY;
+
+    for (int i = 1; i < points.size(); ++i)
     {
-        QList<T> list = p.toList();
-        for (int k=0, s=list.size(), max=(s/2); k<max; k++)
-        {
-			list.swapItemsAt(k, s-(1+k));
-        }
-        p = list.toVector();
+        const QPointF p = transform.map(points.at(i));
+        minX = qMin(minX, p.x());
+        minY = qMin(minY, p.y());
+        maxX = qMax(maxX, p.x());
+        maxY = qMax(maxY, p.y());
     }
-    return p;
+
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::ClearCache()
+{
+    d->rotations = VLayoutRotations();
+
+    QMutexLocker locker(&d->cacheMutex);
+    d->mappedLayoutAllowance.clear();
+    d->layoutAllowanceCached = false;
+    d->layoutBoundingRectCached = false;
+    d->detailBoundingRectCached = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1229,6 +1319,9 @@ void VLayoutPiece::createGrainlineItem(QGraphicsItem *parent, bool textAsPaths)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DetailPath return not transformed outline of detail (seam allowance or main path).
+ */
 QVector<QPointF> VLayoutPiece::DetailPath() const
 {
     if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
@@ -1318,10 +1411,14 @@ bool VLayoutPiece::isMirror() const
 void VLayoutPiece::SetMirror(bool value)
 {
     d->mirror = value;
+    ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
+/**
+ * @brief MappedEdge return edge i (counting from 1) of path after transformation. Mirrored path has reversed direction.
+ */
+QLineF VLayoutPiece::MappedEdge(const QVector<QPointF> &path, int i, const QTransform &transform, bool mirror)
 {
     if (i < 1 || i > path.count())
     { // Doesn't exist such edge
@@ -1340,34 +1437,33 @@ QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
         i2 = 0;
     }
 
-    if (d->mirror)
+    if (mirror)
     {
         const int oldI1 = i1;
         const int size = path.size()-1; //-V807
         i1 = size - i2;
         i2 = size - oldI1;
-        return QLineF(d->transform.map(path.at(i2)), d->transform.map(path.at(i1)));
+        return QLineF(transform.map(path.at(i2)), transform.map(path.at(i1)));
     }
     else
     {
-        return QLineF(d->transform.map(path.at(i1)), d->transform.map(path.at(i2)));
+        return QLineF(transform.map(path.at(i1)), transform.map(path.at(i2)));
     }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const
+int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &points, const QPointF &p1)
 {
     if (p1.isNull())
     {
         return 0;
     }
 
-    if (path.count() < 3)
+    if (points.count() < 3)
     {
         return 0;
     }
 
-    const QVector<QPointF> points = Map(path);
     for (int i=0; i < points.size(); i++)
     {
         if (points.at(i) == p1)
@@ -60,6 +60,7 @@
 #include <QRectF>
 #include <QSharedDataPointer>
 #include <QString>
+#include <QTransform>
 #include <QTypeInfo>
 #include <QVector>
 #include <QtGlobal>
@@ -71,6 +72,7 @@
 #include "vabstractpiece.h"
 
 class VLayoutPieceData;
+class VLayoutRotations;
 class VLayoutPiecePath;
 class QGraphicsItem;
 class QGraphicsPathItem;
@@ -102,9 +104,17 @@ class VLayoutPiece :public VAbstractPiece
     void                      setSeamAllowancePoints(const QVector<QPointF> &points, bool seamAllowance = true,
                                                      bool seamAllowanceBuiltIn = false);
 
+    virtual void              SetSeamAllowance(bool value) Q_DECL_OVERRIDE;
+    virtual void              SetSeamAllowanceBuiltIn(bool value) Q_DECL_OVERRIDE;
+    virtual void              setHideSeamLine(bool value) Q_DECL_OVERRIDE;
+
     QVector<QPointF>          getLayoutAllowancePoints() const;
+    QVector<QPointF>          getLayoutAllowance() const;
     void                      SetLayoutAllowancePoints();
 
+    void                      PrepareRotations(int increase);
+    const VLayoutRotations   &Rotations() const;
+
     QVector<QLineF>           getNotches() const;
     void                      setNotches(const QVector<QLineF> &notches);
 
@@ -163,13 +173,22 @@ class VLayoutPiece :public VAbstractPiece
 
     QPainterPath              LayoutAllowancePath() const;
 
+    QVector<QPointF>          DetailPath() const;
+
     Q_REQUIRED_RESULT QGraphicsItem     *GetItem(bool textAsPaths) const;
 
+    static QTransform         RotationTransform(const QPointF &originPoint, qreal degrees);
+    static QTransform         MirrorTransform(const QLineF &edge);
+
+    template <class T>
+    static QVector<T>         MapPoints(const QVector<T> &points, const QTransform &transform, bool mirror);
+    static QRectF             MappedBoundingRect(const QVector<QPointF> &points, const QTransform &transform);
+    static QLineF             MappedEdge(const QVector<QPointF> &path, int i, const QTransform &transform, bool mirror);
+    static int                EdgeByPoint(const QVector<QPointF> &points, const QPointF &p1);
+
 private:
     QSharedDataPointer<VLayoutPieceData> d;
 
-    QVector<QPointF>                     DetailPath() const;
-
     Q_REQUIRED_RESULT QGraphicsPathItem *createMainItem() const;
     void                                 createAllowanceItem(QGraphicsItem *parent) const;
     void                                 createNotchesItem(QGraphicsItem *parent) const;
@@ -184,10 +203,36 @@ class VLayoutPiece :public VAbstractPiece
     template <class T>
     QVector<T>                           Map(const QVector<T> &points) const;
 
-    QLineF                               Edge(const QVector<QPointF> &path, int i) const;
-    int                                  EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const;
+    void                                 ClearCache();
 };
 
 Q_DECLARE_TYPEINFO(VLayoutPiece, Q_MOVABLE_TYPE);
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MapPoints transform points. Mirrored detail has reversed direction of points.
+ */
+template <class T>
+QVector<T> VLayoutPiece::MapPoints(const QVector<T> &points, const QTransform &transform, bool mirror)
+{
+    QVector<T> p;
+    p.reserve(points.size());
+
+    if (mirror)
+    {
+        for (int i = points.size()-1; i >= 0; --i)
+        {
+            p.append(transform.map(points.at(i)));
+        }
+    }
+    else
+    {
+        for (int i = 0; i < points.size(); ++i)
+        {
+            p.append(transform.map(points.at(i)));
+        }
+    }
+    return p;
+}
+
 #endif // VLAYOUTDETAIL_H
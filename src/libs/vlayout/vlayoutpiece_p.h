@@ -53,7 +53,9 @@
 #define VLAYOUTDETAIL_P_H
 
 #include <QSharedData>
+#include <QMutex>
 #include <QPointF>
+#include <QRectF>
 #include <QVector>
 #include <QTransform>
 
@@ -62,6 +64,7 @@
 #include "../vpatterndb/floatItemData/vgrainlinedata.h"
 #include "../vmisc/diagnostic.h"
 #include "vlayoutpiecepath.h"
+#include "vlayoutrotations.h"
 
 #include "vtextmanager.h"
 
@@ -86,9 +89,18 @@ class VLayoutPieceData : public QSharedData
           patternInfo(),
           grainlinePoints(),
           m_tmDetail(),
-          m_tmPattern()
+          m_tmPattern(),
+          rotations(),
+          cacheMutex(),
+          mappedLayoutAllowance(),
+          layoutBoundingRect(),
+          detailBoundingRect(),
+          layoutAllowanceCached(false),
+          layoutBoundingRectCached(false),
+          detailBoundingRectCached(false)
     {}
 
+    // Copy usually happens on detach right before changing transform, so the cache is not copied.
     VLayoutPieceData(const VLayoutPieceData &detail)
         : QSharedData(detail),
           contour(detail.contour),
@@ -104,7 +116,15 @@ class VLayoutPieceData : public QSharedData
           patternInfo(detail.patternInfo),
           grainlinePoints(detail.grainlinePoints),
           m_tmDetail(detail.m_tmDetail),
-          m_tmPattern(detail.m_tmPattern)
+          m_tmPattern(detail.m_tmPattern),
+          rotations(detail.rotations),
+          cacheMutex(),
+          mappedLayoutAllowance(),
+          layoutBoundingRect(),
+          detailBoundingRect(),
+          layoutAllowanceCached(false),
+          layoutBoundingRectCached(false),
+          detailBoundingRectCached(false)
     {}
 
     ~VLayoutPieceData() {}
@@ -123,6 +143,17 @@ class VLayoutPieceData : public QSharedData
     QVector<QPointF>           grainlinePoints;    //! @brief grainlineInfo line
     VTextManager               m_tmDetail;         //! @brief m_tmDetail text manager for laying out detail info
     VTextManager               m_tmPattern;        //! @brief m_tmPattern text manager for laying out pattern info */
+    VLayoutRotations           rotations;          //! @brief rotations prepared rotation sweep for current transform
+
+    // Cache of values that depend on transform. Filled on demand, cleared when transform or points change. Shared
+    // data can be read from several layout threads at the same time, so access goes through the mutex.
+    mutable QMutex             cacheMutex;
+    mutable QVector<QPointF>   mappedLayoutAllowance;
+    mutable QRectF             layoutBoundingRect;
+    mutable QRectF             detailBoundingRect;
+    mutable bool               layoutAllowanceCached;
+    mutable bool               layoutBoundingRectCached;
+    mutable bool               detailBoundingRectCached;
 
 private:
     VLayoutPieceData &operator=(const VLayoutPieceData &) Q_DECL_EQ_DELETE;
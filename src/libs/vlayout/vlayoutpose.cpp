@@ -0,0 +1,205 @@
+/**************************************************************************
+ **
+ **  @file   vlayoutpose.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vlayoutpose.h"
+
+#include "vlayoutrotations.h"
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VLayoutPose create pose in the current position of the piece. The piece must outlive the pose.
+ */
+VLayoutPose::VLayoutPose(const VLayoutPiece &piece)
+    : m_piece(&piece),
+      m_detailPath(piece.DetailPath()),
+      m_layoutAllowance(piece.getLayoutAllowance()),
+      m_transform(piece.getTransform()),
+      m_mirror(piece.isMirror()),
+      m_rotations(piece.Rotations().IsEmpty() ? nullptr : &piece.Rotations()),
+      m_rotationIndex(0),
+      m_rotated(false),
+      m_offset(),
+      m_mappedLayoutAllowance(),
+      m_detailBoundingRect(),
+      m_layoutBoundingRect(),
+      m_layoutAllowanceCached(false),
+      m_detailRectCached(false),
+      m_layoutRectCached(false)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+QTransform VLayoutPose::Transform() const
+{
+    return m_transform;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutPose::IsMirror() const
+{
+    return m_mirror;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutPose::IsForbidFlipping() const
+{
+    return m_piece->IsForbidFlipping();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPose::Translate(qreal dx, qreal dy)
+{
+    m_transform *= QTransform::fromTranslate(dx, dy);
+    m_offset += QPointF(dx, dy);
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPose::Rotate(const QPointF &originPoint, qreal degrees)
+{
+    const int index = (m_rotations != nullptr && not m_rotated) ? m_rotations->Index(degrees) : -1;
+    if (index >= 0)
+    {
+        m_transform *= m_rotations->Rotation(index, originPoint);
+        m_offset = m_rotations->Map(index, m_offset - originPoint) + originPoint;
+        m_rotationIndex = index;
+        m_rotated = true;
+    }
+    else
+    {
+        m_transform *= VLayoutPiece::RotationTransform(originPoint, degrees);
+        m_rotations = nullptr;
+    }
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPose::Mirror(const QLineF &edge)
+{
+    if (edge.isNull())
+    {
+        return;
+    }
+
+    m_transform *= VLayoutPiece::MirrorTransform(edge);
+    m_mirror = not m_mirror;
+    m_rotations = nullptr;
+    ClearCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutPose::DetailEdgesCount() const
+{
+    return m_detailPath.count();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QLineF VLayoutPose::DetailEdge(int i) const
+{
+    return VLayoutPiece::MappedEdge(m_detailPath, i, m_transform, m_mirror);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutPose::DetailEdgeByPoint(const QPointF &p1) const
+{
+    return VLayoutPiece::EdgeByPoint(VLayoutPiece::MapPoints(m_detailPath, m_transform, m_mirror), p1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutPose::LayoutEdgesCount() const
+{
+    return m_layoutAllowance.count();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QLineF VLayoutPose::LayoutEdge(int i) const
+{
+    return VLayoutPiece::MappedEdge(m_layoutAllowance, i, m_transform, m_mirror);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutPose::LayoutEdgeByPoint(const QPointF &p1) const
+{
+    return VLayoutPiece::EdgeByPoint(LayoutAllowancePoints(), p1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VLayoutPose::DetailBoundingRect() const
+{
+    if (not m_detailRectCached)
+    {
+        m_detailBoundingRect = m_rotations != nullptr
+                ? m_rotations->DetailBoundingRect(m_rotationIndex).translated(m_offset)
+                : VLayoutPiece::MappedBoundingRect(m_detailPath, m_transform);
+        m_detailRectCached = true;
+    }
+    return m_detailBoundingRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VLayoutPose::LayoutBoundingRect() const
+{
+    if (not m_layoutRectCached)
+    {
+        m_layoutBoundingRect = m_rotations != nullptr
+                ? m_rotations->LayoutBoundingRect(m_rotationIndex).translated(m_offset)
+                : VLayoutPiece::MappedBoundingRect(m_layoutAllowance, m_transform);
+        m_layoutRectCached = true;
+    }
+    return m_layoutBoundingRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+const QVector<QPointF> &VLayoutPose::LayoutAllowancePoints() const
+{
+    if (not m_layoutAllowanceCached)
+    {
+        m_mappedLayoutAllowance = VLayoutPiece::MapPoints(m_layoutAllowance, m_transform, m_mirror);
+        m_layoutAllowanceCached = true;
+    }
+    return m_mappedLayoutAllowance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Materialize return copy of the piece placed in this pose. Detaches piece data, use only for a final result.
+ */
+VLayoutPiece VLayoutPose::Materialize() const
+{
+    VLayoutPiece piece = *m_piece;
+    piece.setTransform(m_transform);
+    piece.SetMirror(m_mirror);
+    return piece;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPose::ClearCache()
+{
+    m_layoutAllowanceCached = false;
+    m_detailRectCached = false;
+    m_layoutRectCached = false;
+}
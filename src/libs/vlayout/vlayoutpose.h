@@ -0,0 +1,106 @@
+/**************************************************************************
+ **
+ **  @file   vlayoutpose.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VLAYOUTPOSE_H
+#define VLAYOUTPOSE_H
+
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QTransform>
+#include <QVector>
+#include <QtGlobal>
+
+#include "vlayoutpiece.h"
+
+class VLayoutRotations;
+
+/**
+ * @brief The VLayoutPose class candidate placement of a layout piece.
+ *
+ * Keeps only a transformation and a mirror flag on top of the shared untransformed outlines of a piece. Moving a pose
+ * never detaches piece data, so checking a candidate position costs a few matrix operations instead of a deep copy.
+ * Transformed points and bounding rects are cached until the next move. If the piece has a prepared rotation sweep
+ * (see VLayoutPiece::PrepareRotations) a translated pose rotated by an angle of the sweep takes its bounding rects from
+ * the sweep. A pose is not thread safe, use one per thread.
+ */
+class VLayoutPose
+{
+public:
+    explicit VLayoutPose(const VLayoutPiece &piece);
+
+    QTransform Transform() const;
+    bool       IsMirror() const;
+    bool       IsForbidFlipping() const;
+
+    void Translate(qreal dx, qreal dy);
+    void Rotate(const QPointF &originPoint, qreal degrees);
+    void Mirror(const QLineF &edge);
+
+    int    DetailEdgesCount() const;
+    QLineF DetailEdge(int i) const;
+    int    DetailEdgeByPoint(const QPointF &p1) const;
+
+    int    LayoutEdgesCount() const;
+    QLineF LayoutEdge(int i) const;
+    int    LayoutEdgeByPoint(const QPointF &p1) const;
+
+    QRectF DetailBoundingRect() const;
+    QRectF LayoutBoundingRect() const;
+
+    const QVector<QPointF> &LayoutAllowancePoints() const;
+
+    VLayoutPiece Materialize() const;
+
+private:
+    const VLayoutPiece *m_piece;
+    QVector<QPointF>    m_detailPath;
+    QVector<QPointF>    m_layoutAllowance;
+    QTransform          m_transform;
+    bool                m_mirror;
+
+    /** @brief m_rotations prepared sweep of the piece or nullptr. Valid while the pose has been only translated and
+     * rotated once by an angle of the sweep. */
+    const VLayoutRotations *m_rotations;
+    /** @brief m_rotationIndex sweep angle the pose was rotated by, 0 if not rotated yet. */
+    int                 m_rotationIndex;
+    bool                m_rotated;
+    /** @brief m_offset translation between the outlines rotated around the origin and the pose. */
+    QPointF             m_offset;
+
+    mutable QVector<QPointF> m_mappedLayoutAllowance;
+    mutable QRectF           m_detailBoundingRect;
+    mutable QRectF           m_layoutBoundingRect;
+    mutable bool             m_layoutAllowanceCached;
+    mutable bool             m_detailRectCached;
+    mutable bool             m_layoutRectCached;
+
+    void ClearCache();
+};
+
+#endif // VLAYOUTPOSE_H
@@ -0,0 +1,219 @@
+/**************************************************************************
+ **
+ **  @file   vlayoutrotations.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vlayoutrotations.h"
+
+#include <QtMath>
+#include <cmath>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Exact values for right angles, the same way QTransform::rotate does.
+void SinCos(int degrees, qreal &sinA, qreal &cosA)
+{
+    switch (degrees)
+    {
+        case 0:
+            sinA = 0;
+            cosA = 1;
+            break;
+        case 90:
+            sinA = 1;
+            cosA = 0;
+            break;
+        case 180:
+            sinA = 0;
+            cosA = -1;
+            break;
+        case 270:
+            sinA = -1;
+            cosA = 0;
+            break;
+        default:
+        {
+            const qreal rad = qDegreesToRadians(static_cast<qreal>(degrees));
+            sinA = qSin(rad);
+            cosA = qCos(rad);
+            break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF RotatedBoundingRect(const QVector<QPointF> &points, const QTransform &transform, qreal sinA, qreal cosA)
+{
+    if (points.isEmpty())
+    {
+        return QRectF();
+    }
+
+    qreal minX = 0;
+    qreal minY = 0;
+    qreal maxX = 0;
+    qreal maxY = 0;
+    for (int i = 0; i < points.size(); ++i)
+    {
+        const QPointF p = transform.map(points.at(i));
+        const qreal x = cosA*p.x() + sinA*p.y();
+        const qreal y = cosA*p.y() - sinA*p.x();
+        if (i == 0)
+        {
+            minX = maxX = x;
+            minY = maxY = y;
+        }
+        else
+        {
+            minX = qMin(minX, x);
+            maxX = qMax(maxX, x);
+            minY = qMin(minY, y);
+            maxY = qMax(maxY, y);
+        }
+    }
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutRotations::VLayoutRotations()
+    : m_increase(0),
+      m_sin(),
+      m_cos(),
+      m_detailRects(),
+      m_layoutRects()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VLayoutRotations build the sweep for outlines placed by transform. Points are mapped once per angle here
+ * instead of once per angle for every edge pair of every sheet.
+ */
+VLayoutRotations::VLayoutRotations(const QVector<QPointF> &detailPath, const QVector<QPointF> &layoutAllowance,
+                                   const QTransform &transform, int increase)
+    : m_increase(0),
+      m_sin(),
+      m_cos(),
+      m_detailRects(),
+      m_layoutRects()
+{
+    if (increase < 1 || increase > 180 || 360 % increase != 0)
+    {
+        return;
+    }
+
+    m_increase = increase;
+    const int count = 360 / increase;
+    m_sin.reserve(count);
+    m_cos.reserve(count);
+    m_detailRects.reserve(count);
+    m_layoutRects.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        qreal sinA = 0;
+        qreal cosA = 1;
+        SinCos(i * increase, sinA, cosA);
+        m_sin.append(sinA);
+        m_cos.append(cosA);
+        m_detailRects.append(RotatedBoundingRect(detailPath, transform, sinA, cosA));
+        m_layoutRects.append(RotatedBoundingRect(layoutAllowance, transform, sinA, cosA));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutRotations::IsEmpty() const
+{
+    return m_increase == 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutRotations::Increase() const
+{
+    return m_increase;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Index return index of the angle in the sweep or -1 if the sweep doesn't contain the angle.
+ */
+int VLayoutRotations::Index(qreal degrees) const
+{
+    if (IsEmpty())
+    {
+        return -1;
+    }
+
+    qreal angle = std::fmod(degrees, 360.0);
+    if (angle < 0)
+    {
+        angle += 360;
+    }
+
+    const int rounded = qRound(angle);
+    if (qAbs(angle - rounded) > 1e-9 || rounded % m_increase != 0)
+    {
+        return -1;
+    }
+
+    return (rounded % 360) / m_increase;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Map rotate point around the origin.
+ */
+QPointF VLayoutRotations::Map(int index, const QPointF &point) const
+{
+    const qreal sinA = m_sin.at(index);
+    const qreal cosA = m_cos.at(index);
+    return QPointF(cosA*point.x() + sinA*point.y(), cosA*point.y() - sinA*point.x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Rotation same as VLayoutPiece::RotationTransform, but without trigonometric calls.
+ */
+QTransform VLayoutRotations::Rotation(int index, const QPointF &originPoint) const
+{
+    const qreal sinA = m_sin.at(index);
+    const qreal cosA = m_cos.at(index);
+    const QPointF rotated = Map(index, originPoint);
+    return QTransform(cosA, -sinA, sinA, cosA, originPoint.x() - rotated.x(), originPoint.y() - rotated.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VLayoutRotations::DetailBoundingRect(int index) const
+{
+    return m_detailRects.at(index);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VLayoutRotations::LayoutBoundingRect(int index) const
+{
+    return m_layoutRects.at(index);
+}
@@ -0,0 +1,73 @@
+/**************************************************************************
+ **
+ **  @file   vlayoutrotations.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VLAYOUTROTATIONS_H
+#define VLAYOUTROTATIONS_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QTransform>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VLayoutRotations class precomputed rotation sweep of a layout piece.
+ *
+ * Keeps sin/cos of every angle of the sweep (0, increase, 2*increase, ... < 360) and bounding rects of the piece
+ * outlines rotated around the origin by these angles. Rotating a placed piece around any point differs from a rotation
+ * around the origin only by translation, so a candidate of the sweep gets its bounding rects without mapping points.
+ * Angles have the same direction as VLayoutPiece::Rotate.
+ */
+class VLayoutRotations
+{
+public:
+    VLayoutRotations();
+    VLayoutRotations(const QVector<QPointF> &detailPath, const QVector<QPointF> &layoutAllowance,
+                     const QTransform &transform, int increase);
+
+    bool IsEmpty() const;
+    int  Increase() const;
+    int  Index(qreal degrees) const;
+
+    QPointF    Map(int index, const QPointF &point) const;
+    QTransform Rotation(int index, const QPointF &originPoint) const;
+
+    QRectF DetailBoundingRect(int index) const;
+    QRectF LayoutBoundingRect(int index) const;
+
+private:
+    int             m_increase;
+    QVector<qreal>  m_sin;
+    QVector<qreal>  m_cos;
+    QVector<QRectF> m_detailRects;
+    QVector<QRectF> m_layoutRects;
+};
+
+Q_DECLARE_TYPEINFO(VLayoutRotations, Q_MOVABLE_TYPE);
+
+#endif // VLAYOUTROTATIONS_H
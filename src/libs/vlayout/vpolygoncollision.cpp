@@ -0,0 +1,336 @@
+/**************************************************************************
+ **
+ **  @file   vpolygoncollision.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vpolygoncollision.h"
+
+#include "vsegmentgrid.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+inline bool ComparePoints(const QPointF &a, const QPointF &b)
+{
+    return qFuzzyCompare(a.x() + 1, b.x() + 1) && qFuzzyCompare(a.y() + 1, b.y() + 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Dot(const QPointF &a, const QPointF &b)
+{
+    return a.x() * b.x() + a.y() * b.y();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Winding contribution of edge (a, b) for horizontal ray going from point to the right.
+ */
+inline int Winding(const QPointF &a, const QPointF &b, const QPointF &point)
+{
+    if (a.y() <= point.y())
+    {
+        if (b.y() > point.y())
+        {
+            const qreal side = (b.x() - a.x()) * (point.y() - a.y()) - (point.x() - a.x()) * (b.y() - a.y());
+            if (side > 0)
+            {
+                return 1; // upward crossing, point is left of edge
+            }
+        }
+    }
+    else if (b.y() <= point.y())
+    {
+        const qreal side = (b.x() - a.x()) * (point.y() - a.y()) - (point.x() - a.x()) * (b.y() - a.y());
+        if (side < 0)
+        {
+            return -1; // downward crossing, point is right of edge
+        }
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline QRectF CommonRect(const QRectF &r1, const QRectF &r2)
+{
+    return QRectF(QPointF(qMax(r1.left(), r2.left()), qMax(r1.top(), r2.top())),
+                  QPointF(qMin(r1.right(), r2.right()), qMin(r1.bottom(), r2.bottom())));
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VPolygonCollision::BoundingRect(const QVector<QPointF> &points)
+{
+    if (points.isEmpty())
+    {
+        return QRectF();
+    }
+
+    qreal minX = points.at(0).x();
+    qreal minY = points.at(0).y();
+    qreal maxX = minX;
+    qreal maxY = minY;
+
+    for (int i = 1; i < points.size(); ++i)
+    {
+        const QPointF &p = points.at(i);
+        minX = qMin(minX, p.x());
+        minY = qMin(minY, p.y());
+        maxX = qMax(maxX, p.x());
+        maxY = qMax(maxY, p.y());
+    }
+
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SegmentsIntersect check if two closed segments have common points. Touching ends and collinear overlapping
+ * count as intersection. Degenerate segments never intersect.
+ */
+bool VPolygonCollision::SegmentsIntersect(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2)
+{
+    if (ComparePoints(p1, p2) || ComparePoints(q1, q2))
+    {
+        return false;
+    }
+
+    if ((ComparePoints(p1, q1) && ComparePoints(p2, q2)) || (ComparePoints(p1, q2) && ComparePoints(p2, q1)))
+    {
+        return true;
+    }
+
+    const QPointF pDelta = p2 - p1;
+    const QPointF qDelta = q2 - q1;
+
+    const qreal par = pDelta.x() * qDelta.y() - pDelta.y() * qDelta.x();
+
+    if (qFuzzyIsNull(par))
+    {
+        const QPointF normal(-pDelta.y(), pDelta.x());
+
+        // coinciding?
+        if (qFuzzyIsNull(Dot(normal, q1 - p1)))
+        {
+            const qreal dp = Dot(pDelta, pDelta);
+
+            const qreal tq1 = Dot(pDelta, q1 - p1);
+            const qreal tq2 = Dot(pDelta, q2 - p1);
+
+            if ((tq1 > 0 && tq1 < dp) || (tq2 > 0 && tq2 < dp))
+            {
+                return true;
+            }
+
+            const qreal dq = Dot(qDelta, qDelta);
+
+            const qreal tp1 = Dot(qDelta, p1 - q1);
+            const qreal tp2 = Dot(qDelta, p2 - q1);
+
+            if ((tp1 > 0 && tp1 < dq) || (tp2 > 0 && tp2 < dq))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const qreal invPar = 1 / par;
+
+    const qreal tp = (qDelta.y() * (q1.x() - p1.x()) - qDelta.x() * (q1.y() - p1.y())) * invPar;
+
+    if (tp < 0 || tp > 1)
+    {
+        return false;
+    }
+
+    const qreal tq = (pDelta.y() * (q1.x() - p1.x()) - pDelta.x() * (q1.y() - p1.y())) * invPar;
+
+    return tq >= 0 && tq <= 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonContains check if point is inside closed polygon. Uses non-zero winding rule (Qt::WindingFill).
+ */
+bool VPolygonCollision::PolygonContains(const QVector<QPointF> &polygon, const QPointF &point)
+{
+    if (polygon.size() < 3)
+    {
+        return false;
+    }
+
+    int winding = 0;
+    for (int i = 0, prev = polygon.size() - 1; i < polygon.size(); prev = i++)
+    {
+        winding += Winding(polygon.at(prev), polygon.at(i), point);
+    }
+
+    return winding != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonsIntersect check if two closed polygons have common area or common boundary points.
+ *
+ * Only edges whose bounding rects touch the overlapping part of polygons bounding rects are tested against each
+ * other. If no edges cross we still need to check if one polygon lies inside the other.
+ */
+bool VPolygonCollision::PolygonsIntersect(const QVector<QPointF> &polygon1, const QVector<QPointF> &polygon2)
+{
+    if (polygon1.isEmpty() || polygon2.isEmpty())
+    {
+        return false;
+    }
+
+    const QRectF r1 = BoundingRect(polygon1);
+    const QRectF r2 = BoundingRect(polygon2);
+
+    if (not RectsOverlap(r1, r2))
+    {
+        return false;
+    }
+
+    const QRectF common = CommonRect(r1, r2);
+
+    // Edges of the first polygon that can cross anything
+    QVector<int> edges1;
+    edges1.reserve(polygon1.size());
+    for (int i = 0; i < polygon1.size(); ++i)
+    {
+        if (RectsOverlap(SegmentRect(polygon1.at(i), polygon1.at(i+1 < polygon1.size() ? i+1 : 0)), common))
+        {
+            edges1.append(i);
+        }
+    }
+
+    if (EdgesIntersect(polygon1, edges1, polygon2, common))
+    {
+        return true;
+    }
+
+    // No crossing edges. Polygons intersect only if one contains the other.
+    return (r1.contains(polygon2.first()) && PolygonContains(polygon1, polygon2.first()))
+            || (r2.contains(polygon1.first()) && PolygonContains(polygon2, polygon1.first()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonContains the same as above, but only edges from the grid that can cross the ray are checked.
+ */
+bool VPolygonCollision::PolygonContains(const QVector<QPointF> &polygon, const VSegmentGrid &grid,
+                                        const QPointF &point)
+{
+    if (polygon.size() < 3)
+    {
+        return false;
+    }
+
+    const QRectF ray(point, QPointF(qMax(point.x(), grid.BoundingRect().right()), point.y()));
+    const QVector<int> edges = grid.Segments(ray);
+
+    int winding = 0;
+    for (int e = 0; e < edges.size(); ++e)
+    {
+        const int i = edges.at(e);
+        winding += Winding(polygon.at(i), polygon.at(i+1 < polygon.size() ? i+1 : 0), point);
+    }
+
+    return winding != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonsIntersect the same as above, but edges of the first polygon are taken from its grid. Global contour
+ * of a sheet grows with every placed piece, a grid keeps the test local to the area around the second polygon.
+ */
+bool VPolygonCollision::PolygonsIntersect(const QVector<QPointF> &polygon1, const VSegmentGrid &grid1,
+                                          const QVector<QPointF> &polygon2)
+{
+    if (polygon1.isEmpty() || polygon2.isEmpty() || grid1.IsEmpty())
+    {
+        return false;
+    }
+
+    const QRectF r1 = grid1.BoundingRect();
+    const QRectF r2 = BoundingRect(polygon2);
+
+    if (not RectsOverlap(r1, r2))
+    {
+        return false;
+    }
+
+    const QRectF common = CommonRect(r1, r2);
+
+    if (EdgesIntersect(polygon1, grid1.Segments(common), polygon2, common))
+    {
+        return true;
+    }
+
+    // No crossing edges. Polygons intersect only if one contains the other.
+    return (r1.contains(polygon2.first()) && PolygonContains(polygon1, grid1, polygon2.first()))
+            || (r2.contains(polygon1.first()) && PolygonContains(polygon2, polygon1.first()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EdgesIntersect check listed edges of the first polygon against edges of the second polygon. Only edges of the
+ * second polygon that touch common rect of both polygons are checked.
+ */
+bool VPolygonCollision::EdgesIntersect(const QVector<QPointF> &polygon1, const QVector<int> &edges1,
+                                       const QVector<QPointF> &polygon2, const QRectF &common)
+{
+    if (edges1.isEmpty())
+    {
+        return false;
+    }
+
+    for (int j = 0; j < polygon2.size(); ++j)
+    {
+        const QPointF &q1 = polygon2.at(j);
+        const QPointF &q2 = polygon2.at(j+1 < polygon2.size() ? j+1 : 0);
+        const QRectF qRect = SegmentRect(q1, q2);
+
+        if (not RectsOverlap(qRect, common))
+        {
+            continue;
+        }
+
+        for (int e = 0; e < edges1.size(); ++e)
+        {
+            const int i = edges1.at(e);
+            const QPointF &p1 = polygon1.at(i);
+            const QPointF &p2 = polygon1.at(i+1 < polygon1.size() ? i+1 : 0);
+
+            if (RectsOverlap(qRect, SegmentRect(p1, p2)) && SegmentsIntersect(p1, p2, q1, q2))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
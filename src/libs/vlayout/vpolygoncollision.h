@@ -0,0 +1,82 @@
+/**************************************************************************
+ **
+ **  @file   vpolygoncollision.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VPOLYGONCOLLISION_H
+#define VPOLYGONCOLLISION_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+class VSegmentGrid;
+
+/**
+ * @brief The VPolygonCollision class collision tests for closed polygons given as list of points.
+ *
+ * Used by layout instead of QPainterPath::intersects()/contains(). The verdicts follow QPainterPath with winding fill:
+ * two polygons collide if any of their edges cross or touch, or if one of them lies inside the other.
+ */
+class VPolygonCollision
+{
+public:
+    static QRectF BoundingRect(const QVector<QPointF> &points);
+
+    static bool SegmentsIntersect(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2);
+    static bool PolygonContains(const QVector<QPointF> &polygon, const QPointF &point);
+    static bool PolygonContains(const QVector<QPointF> &polygon, const VSegmentGrid &grid, const QPointF &point);
+    static bool PolygonsIntersect(const QVector<QPointF> &polygon1, const QVector<QPointF> &polygon2);
+    static bool PolygonsIntersect(const QVector<QPointF> &polygon1, const VSegmentGrid &grid1,
+                                  const QVector<QPointF> &polygon2);
+
+    static bool RectsOverlap(const QRectF &r1, const QRectF &r2);
+    static QRectF SegmentRect(const QPointF &p1, const QPointF &p2);
+
+private:
+    static bool EdgesIntersect(const QVector<QPointF> &polygon1, const QVector<int> &edges1,
+                               const QVector<QPointF> &polygon2, const QRectF &common);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RectsOverlap unlike QRectF::intersects() treats touching and degenerate (zero width or height) rects as
+ * overlapping. Horizontal and vertical segments have such bounding rects.
+ */
+inline bool VPolygonCollision::RectsOverlap(const QRectF &r1, const QRectF &r2)
+{
+    return r1.left() <= r2.right() && r2.left() <= r1.right() && r1.top() <= r2.bottom() && r2.top() <= r1.bottom();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline QRectF VPolygonCollision::SegmentRect(const QPointF &p1, const QPointF &p2)
+{
+    return QRectF(QPointF(qMin(p1.x(), p2.x()), qMin(p1.y(), p2.y())),
+                  QPointF(qMax(p1.x(), p2.x()), qMax(p1.y(), p2.y())));
+}
+
+#endif // VPOLYGONCOLLISION_H
@@ -62,6 +62,7 @@
 #include <QPolygonF>
 #include <QRect>
 #include <QRectF>
+#include <QSemaphore>
 #include <QSizeF>
 #include <QStaticStringData>
 #include <QString>
@@ -71,24 +72,31 @@
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "vpolygoncollision.h"
 
 //---------------------------------------------------------------------------------------------------------------------
-VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &detail, int i, std::atomic_bool *stop,
-                     bool rotate, int rotationIncrease, bool saveLength)
+VPosition::VPosition(const VContour &gContour, const VLayoutPiece &detail, int detailEdgesCount, int firstPair,
+                     int lastPair, std::atomic_bool *stop, bool rotate, int rotationIncrease, bool saveLength,
+                     QSemaphore *finished)
     : QRunnable(),
       bestResult(VBestSquare(gContour.GetSize(), saveLength)),
       gContour(gContour),
       detail(detail),
-      i(i),
-      j(j),
+      detailEdgesCount(detailEdgesCount),
+      firstPair(firstPair),
+      lastPair(lastPair),
+      i(0),
+      j(0),
       paperIndex(0),
       frame(0),
       detailsCount(0),
       details(),
       stop(stop),
+      finished(finished),
       rotate(rotate),
       rotationIncrease(rotationIncrease),
-      angle_between(0)
+      angle_between(0),
+      crossingCount(0)
 {
     if ((rotationIncrease >= 1 && rotationIncrease <= 180 && 360 % rotationIncrease == 0) == false)
     {
@@ -99,24 +107,56 @@ VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &detail
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::run()
 {
-    if (stop->load())
+    FindBestPosition();
+
+    if (finished != nullptr)
     {
-        return;
+        finished->release();
     }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FindBestPosition checks all edge pairs of the batch. Each pair index maps to global contour edge j and
+ * detail edge i. All pairs share the same contour and detail, the best result is reduced locally.
+ */
+void VPosition::FindBestPosition()
+{
+    const quint32 startFrame = frame;
+    const quint32 pairFrames = 3 + static_cast<quint32>(360/rotationIncrease*2);
+
+    for (int pair = firstPair; pair < lastPair; ++pair)
+    {
+        if (stop->load())
+        {
+            return;
+        }
 
-    // We should use copy of the detail.
-    VLayoutPiece workDetail = detail;
+        j = pair / detailEdgesCount + 1;
+        i = pair % detailEdgesCount + 1;
+        angle_between = 0;
+        frame = startFrame + static_cast<quint32>(pair - firstPair) * pairFrames;
+
+        FindBestPairPosition();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPosition::FindBestPairPosition()
+{
+    // Pose only moves the detail, the detail itself stays shared.
+    VLayoutPose pose(detail);
 
     int dEdge = i;// For mirror detail edge will be different
-    if (CheckCombineEdges(workDetail, j, dEdge))
+    if (CheckCombineEdges(pose, j, dEdge))
     {
         #ifdef LAYOUT_DEBUG
         #   ifdef SHOW_CANDIDATE_BEST
-                DrawDebug(gContour, workDetail, frame+2, paperIndex, detailsCount, details);
+                DrawDebug(gContour, pose.Materialize(), frame+2, paperIndex, detailsCount, details);
         #   endif
         #endif
 
-        SaveCandidate(bestResult, workDetail, j, dEdge, BestFrom::Combine);
+        SaveCandidate(bestResult, pose, j, dEdge, BestFrom::Combine);
     }
     frame = frame + 3;
 
@@ -184,6 +224,12 @@ VBestSquare VPosition::getBestResult() const
     return bestResult;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+qint64 VPosition::getCrossingCount() const
+{
+    return crossingCount;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::DrawDebug(const VContour &contour, const VLayoutPiece &detail, int frame, quint32 paperIndex,
                           int detailsCount, const QVector<VLayoutPiece> &details)
@@ -276,36 +322,36 @@ int VPosition::Bias(int length, int maxLength)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VPosition::SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &detail, int globalI, int detJ,
+void VPosition::SaveCandidate(VBestSquare &bestResult, const VLayoutPose &pose, int globalI, int detJ,
                               BestFrom type)
 {
-    QVector<QPointF> newGContour = gContour.UniteWithContour(detail, globalI, detJ, type);
+    QVector<QPointF> newGContour = gContour.UniteWithContour(pose.LayoutAllowancePoints(), globalI, detJ, type);
     newGContour.append(newGContour.first());
     const QSizeF size = QPolygonF(newGContour).boundingRect().size();
-    bestResult.NewResult(size, globalI, detJ, detail.getTransform(), detail.isMirror(), type);
+    bestResult.NewResult(size, globalI, detJ, pose.Transform(), pose.IsMirror(), type);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
+bool VPosition::CheckCombineEdges(VLayoutPose &pose, int j, int &dEdge)
 {
     const QLineF globalEdge = gContour.GlobalEdge(j);
     bool flagMirror = false;
     bool flagSquare = false;
 
-    CombineEdges(detail, globalEdge, dEdge);
+    CombineEdges(pose, globalEdge, dEdge);
 
 #ifdef LAYOUT_DEBUG
 #   ifdef SHOW_COMBINE
-        DrawDebug(gContour, detail, frame, paperIndex, detailsCount, details);
+        DrawDebug(gContour, pose.Materialize(), frame, paperIndex, detailsCount, details);
 #   endif
 #endif
 
     CrossingType type = CrossingType::Intersection;
-    if (SheetContains(detail.DetailBoundingRect()))
+    if (SheetContains(pose.DetailBoundingRect()))
     {
         if (not gContour.GetContour().isEmpty())
         {
-            type = Crossing(detail);
+            type = Crossing(pose);
         }
         else
         {
@@ -318,7 +364,7 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
         case CrossingType::EdgeError:
             return false;
         case CrossingType::Intersection:
-            detail.Mirror(globalEdge);
+            pose.Mirror(globalEdge);
             flagMirror = true;
             break;
         case CrossingType::NoIntersection:
@@ -328,21 +374,21 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
             break;
     }
 
-    if (flagMirror && not detail.IsForbidFlipping())
+    if (flagMirror && not pose.IsForbidFlipping())
     {
         #ifdef LAYOUT_DEBUG
             #ifdef SHOW_MIRROR
-                DrawDebug(gContour, detail, frame+1, paperIndex, detailsCount, details);
+                DrawDebug(gContour, pose.Materialize(), frame+1, paperIndex, detailsCount, details);
             #endif
         #endif
 
         if (gContour.GetContour().isEmpty())
         {
-            dEdge = detail.DetailEdgeByPoint(globalEdge.p2());
+            dEdge = pose.DetailEdgeByPoint(globalEdge.p2());
         }
         else
         {
-            dEdge = detail.LayoutEdgeByPoint(globalEdge.p2());
+            dEdge = pose.LayoutEdgeByPoint(globalEdge.p2());
         }
 
         if (dEdge <= 0)
@@ -351,9 +397,9 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
         }
 
         CrossingType type = CrossingType::Intersection;
-        if (SheetContains(detail.DetailBoundingRect()))
+        if (SheetContains(pose.DetailBoundingRect()))
         {
-            type = Crossing(detail);
+            type = Crossing(pose);
         }
 
         switch (type)
@@ -374,23 +420,23 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VPosition::CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, int angle) const
+bool VPosition::CheckRotationEdges(VLayoutPose &pose, int j, int dEdge, int angle) const
 {
     const QLineF globalEdge = gContour.GlobalEdge(j);
     bool flagSquare = false;
 
-    RotateEdges(detail, globalEdge, dEdge, angle);
+    RotateEdges(pose, globalEdge, dEdge, angle);
 
 #ifdef LAYOUT_DEBUG
     #ifdef SHOW_ROTATION
-        DrawDebug(gContour, detail, frame, paperIndex, detailsCount, details);
+        DrawDebug(gContour, pose.Materialize(), frame, paperIndex, detailsCount, details);
     #endif
 #endif
 
     CrossingType type = CrossingType::Intersection;
-    if (SheetContains(detail.DetailBoundingRect()))
+    if (SheetContains(pose.DetailBoundingRect()))
     {
-        type = Crossing(detail);
+        type = Crossing(pose);
     }
 
     switch (type)
@@ -410,23 +456,27 @@ bool VPosition::CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, int a
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-VPosition::CrossingType VPosition::Crossing(const VLayoutPiece &detail) const
+VPosition::CrossingType VPosition::Crossing(const VLayoutPose &pose) const
 {
     const QRectF gRect = gContour.BoundingRect();
-    if (not gRect.intersects(detail.LayoutBoundingRect()) && not gRect.contains(detail.DetailBoundingRect()))
+    if (not gRect.intersects(pose.LayoutBoundingRect()) && not gRect.contains(pose.DetailBoundingRect()))
     {
         // This we can determine efficiently.
         return CrossingType::NoIntersection;
     }
 
-    const QPainterPath gPath = gContour.ContourPath();
-    if (not gPath.intersects(detail.LayoutAllowancePath()) && not gPath.contains(detail.createMainPath()))
+    ++crossingCount;
+
+    // Layout allowance surrounds the main path. If the main path is inside the global contour the layout allowance
+    // either crosses the contour or is inside too, so one polygon test is enough.
+    if (VPolygonCollision::PolygonsIntersect(gContour.GetContour(), gContour.SegmentGrid(),
+                                             pose.LayoutAllowancePoints()))
     {
-        return CrossingType::NoIntersection;
+        return CrossingType::Intersection;
     }
     else
     {
-        return CrossingType::Intersection;
+        return CrossingType::NoIntersection;
     }
 }
 
@@ -438,16 +488,16 @@ bool VPosition::SheetContains(const QRectF &rect) const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VPosition::CombineEdges(VLayoutPiece &detail, const QLineF &globalEdge, const int &dEdge)
+void VPosition::CombineEdges(VLayoutPose &pose, const QLineF &globalEdge, const int &dEdge)
 {
     QLineF detailEdge;
     if (gContour.GetContour().isEmpty())
     {
-        detailEdge = detail.DetailEdge(dEdge);
+        detailEdge = pose.DetailEdge(dEdge);
     }
     else
     {
-        detailEdge = detail.LayoutEdge(dEdge);
+        detailEdge = pose.LayoutEdge(dEdge);
     }
 
     // Find distance between two edges for two begin vertex.
@@ -459,24 +509,24 @@ void VPosition::CombineEdges(VLayoutPiece &detail, const QLineF &globalEdge, con
     angle_between = globalEdge.angleTo(detailEdge); // Seek angle between two edges.
 
     // Now we move detail to position near to global contour edge.
-    detail.Translate(dx, dy);
+    pose.Translate(dx, dy);
     if (not qFuzzyIsNull(angle_between) || not qFuzzyCompare(angle_between, 360))
     {
-        detail.Rotate(detailEdge.p2(), -angle_between);
+        pose.Rotate(detailEdge.p2(), -angle_between);
     }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VPosition::RotateEdges(VLayoutPiece &detail, const QLineF &globalEdge, int dEdge, int angle) const
+void VPosition::RotateEdges(VLayoutPose &pose, const QLineF &globalEdge, int dEdge, int angle) const
 {
     QLineF detailEdge;
     if (gContour.GetContour().isEmpty())
     {
-        detailEdge = detail.DetailEdge(dEdge);
+        detailEdge = pose.DetailEdge(dEdge);
     }
     else
     {
-        detailEdge = detail.LayoutEdge(dEdge);
+        detailEdge = pose.LayoutEdge(dEdge);
     }
 
     // Find distance between two edges for two begin vertex.
@@ -486,8 +536,8 @@ void VPosition::RotateEdges(VLayoutPiece &detail, const QLineF &globalEdge, int
     detailEdge.translate(dx, dy); // Use values for translate detail edge.
 
     // Now we move detail to position near to global contour edge.
-    detail.Translate(dx, dy);
-    detail.Rotate(globalEdge.p2(), angle);
+    pose.Translate(dx, dy);
+    pose.Rotate(globalEdge.p2(), angle);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -505,19 +555,18 @@ void VPosition::Rotate(int increase)
             return;
         }
 
-        // We should use copy of the detail.
-        VLayoutPiece workDetail = detail;
+        VLayoutPose pose(detail);
 
-        if (CheckRotationEdges(workDetail, j, i, angle))
+        if (CheckRotationEdges(pose, j, i, angle))
         {
             #ifdef LAYOUT_DEBUG
             #   ifdef SHOW_CANDIDATE_BEST
                     ++frame;
-                    DrawDebug(gContour, workDetail, frame, paperIndex, detailsCount, details);
+                    DrawDebug(gContour, pose.Materialize(), frame, paperIndex, detailsCount, details);
             #   endif
             #endif
 
-            SaveCandidate(bestResult, workDetail, j, i, BestFrom::Rotation);
+            SaveCandidate(bestResult, pose, j, i, BestFrom::Rotation);
         }
         ++frame;
     }
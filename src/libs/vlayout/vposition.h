@@ -62,12 +62,16 @@
 #include "vcontour.h"
 #include "vlayoutdef.h"
 #include "vlayoutpiece.h"
+#include "vlayoutpose.h"
+
+class QSemaphore;
 
 class VPosition : public QRunnable
 {
 public:
-    VPosition(const VContour &gContour, int j, const VLayoutPiece &detail, int i, std::atomic_bool *stop, bool rotate,
-              int rotationIncrease, bool saveLength);
+    VPosition(const VContour &gContour, const VLayoutPiece &detail, int detailEdgesCount, int firstPair, int lastPair,
+              std::atomic_bool *stop, bool rotate, int rotationIncrease, bool saveLength,
+              QSemaphore *finished = nullptr);
     virtual ~VPosition() Q_DECL_OVERRIDE{}
 
     quint32 getPaperIndex() const;
@@ -82,6 +86,7 @@ class VPosition : public QRunnable
     void setDetails(const QVector<VLayoutPiece> &details);
 
     VBestSquare getBestResult() const;
+    qint64 getCrossingCount() const;
 
     static void DrawDebug(const VContour &contour, const VLayoutPiece &detail, int frame, quint32 paperIndex,
                           int detailsCount, const QVector<VLayoutPiece> &details = QVector<VLayoutPiece>());
@@ -93,6 +98,10 @@ class VPosition : public QRunnable
     VBestSquare bestResult;
     const VContour gContour;
     const VLayoutPiece detail;
+    int detailEdgesCount;
+    /** @brief firstPair, lastPair range [firstPair, lastPair) of edge pairs this batch checks. */
+    int firstPair;
+    int lastPair;
     int i;
     int j;
     quint32 paperIndex;
@@ -100,12 +109,16 @@ class VPosition : public QRunnable
     quint32 detailsCount;
     QVector<VLayoutPiece> details;
     std::atomic_bool *stop;
+    /** @brief finished released once when the runnable has done its work. Lets the caller wake up immediately. */
+    QSemaphore *finished;
     bool rotate;
     int rotationIncrease;
     /**
      * @brief angle_between keep angle between global edge and detail edge. Need for optimization rotation.
      */
     qreal angle_between;
+    /** @brief crossingCount number of polygon collision tests. Statistics only. */
+    mutable qint64 crossingCount;
 
     enum class CrossingType : char
     {
@@ -123,16 +136,19 @@ class VPosition : public QRunnable
 
     virtual void run() Q_DECL_OVERRIDE;
 
-    void SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &detail, int globalI, int detJ, BestFrom type);
+    void FindBestPosition();
+    void FindBestPairPosition();
+
+    void SaveCandidate(VBestSquare &bestResult, const VLayoutPose &pose, int globalI, int detJ, BestFrom type);
 
-    bool CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge);
-    bool CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, int angle) const;
+    bool CheckCombineEdges(VLayoutPose &pose, int j, int &dEdge);
+    bool CheckRotationEdges(VLayoutPose &pose, int j, int dEdge, int angle) const;
 
-    CrossingType Crossing(const VLayoutPiece &detail) const;
+    CrossingType Crossing(const VLayoutPose &pose) const;
     bool         SheetContains(const QRectF &rect) const;
 
-    void CombineEdges(VLayoutPiece &detail, const QLineF &globalEdge, const int &dEdge);
-    void RotateEdges(VLayoutPiece &detail, const QLineF &globalEdge, int dEdge, int angle) const;
+    void CombineEdges(VLayoutPose &pose, const QLineF &globalEdge, const int &dEdge);
+    void RotateEdges(VLayoutPose &pose, const QLineF &globalEdge, int dEdge, int angle) const;
 
     static QPainterPath ShowDirection(const QLineF &edge);
     static QPainterPath DrawContour(const QVector<QPointF> &points);
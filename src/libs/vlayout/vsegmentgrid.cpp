@@ -0,0 +1,148 @@
+/**************************************************************************
+ **
+ **  @file   vsegmentgrid.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vsegmentgrid.h"
+
+#include <algorithm>
+#include <QtMath>
+
+#include "vpolygoncollision.h"
+
+namespace
+{
+const int maxGridSide = 256;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VSegmentGrid::VSegmentGrid()
+    : m_rect(),
+      m_columns(0),
+      m_rows(0),
+      m_cellWidth(0),
+      m_cellHeight(0),
+      m_cells()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+VSegmentGrid::VSegmentGrid(const QVector<QPointF> &polygon)
+    : m_rect(VPolygonCollision::BoundingRect(polygon)),
+      m_columns(0),
+      m_rows(0),
+      m_cellWidth(0),
+      m_cellHeight(0),
+      m_cells()
+{
+    const int count = polygon.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    // About one edge per cell, cells follow aspect ratio of the bounding rect
+    const qreal width = qMax(m_rect.width(), 1.0);
+    const qreal height = qMax(m_rect.height(), 1.0);
+    m_columns = qBound(1, qCeil(qSqrt(count * width / height)), maxGridSide);
+    m_rows = qBound(1, qCeil(static_cast<qreal>(count) / m_columns), maxGridSide);
+    m_cellWidth = width / m_columns;
+    m_cellHeight = height / m_rows;
+
+    m_cells.resize(m_columns * m_rows);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const QRectF edgeRect = VPolygonCollision::SegmentRect(polygon.at(i), polygon.at(i+1 < count ? i+1 : 0));
+
+        const int left = Column(edgeRect.left());
+        const int right = Column(edgeRect.right());
+        const int top = Row(edgeRect.top());
+        const int bottom = Row(edgeRect.bottom());
+
+        for (int row = top; row <= bottom; ++row)
+        {
+            for (int column = left; column <= right; ++column)
+            {
+                m_cells[row * m_columns + column].append(i);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VSegmentGrid::IsEmpty() const
+{
+    return m_cells.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VSegmentGrid::BoundingRect() const
+{
+    return m_rect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Segments return sorted unique indexes of edges that can touch the rect.
+ */
+QVector<int> VSegmentGrid::Segments(const QRectF &rect) const
+{
+    QVector<int> segments;
+
+    if (m_cells.isEmpty() || not VPolygonCollision::RectsOverlap(m_rect, rect))
+    {
+        return segments;
+    }
+
+    const int left = Column(rect.left());
+    const int right = Column(rect.right());
+    const int top = Row(rect.top());
+    const int bottom = Row(rect.bottom());
+
+    for (int row = top; row <= bottom; ++row)
+    {
+        for (int column = left; column <= right; ++column)
+        {
+            segments += m_cells.at(row * m_columns + column);
+        }
+    }
+
+    std::sort(segments.begin(), segments.end());
+    segments.erase(std::unique(segments.begin(), segments.end()), segments.end());
+    return segments;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VSegmentGrid::Column(qreal x) const
+{
+    return qBound(0, qFloor((x - m_rect.left()) / m_cellWidth), m_columns - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VSegmentGrid::Row(qreal y) const
+{
+    return qBound(0, qFloor((y - m_rect.top()) / m_cellHeight), m_rows - 1);
+}
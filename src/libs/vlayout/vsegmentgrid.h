@@ -0,0 +1,68 @@
+/**************************************************************************
+ **
+ **  @file   vsegmentgrid.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VSEGMENTGRID_H
+#define VSEGMENTGRID_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VSegmentGrid class uniform grid over edges of a closed polygon.
+ *
+ * Each cell keeps indexes of edges whose bounding rect touches the cell. Edge i connects point i with point i+1 (the
+ * last edge closes the polygon). Allows to test only edges near a rect instead of walking the whole polygon.
+ */
+class VSegmentGrid
+{
+public:
+    VSegmentGrid();
+    explicit VSegmentGrid(const QVector<QPointF> &polygon);
+
+    bool   IsEmpty() const;
+    QRectF BoundingRect() const;
+
+    QVector<int> Segments(const QRectF &rect) const;
+
+private:
+    QRectF m_rect;
+    int    m_columns;
+    int    m_rows;
+    qreal  m_cellWidth;
+    qreal  m_cellHeight;
+    QVector<QVector<int>> m_cells;
+
+    int Column(qreal x) const;
+    int Row(qreal y) const;
+};
+
+Q_DECLARE_TYPEINFO(VSegmentGrid, Q_MOVABLE_TYPE);
+
+#endif // VSEGMENTGRID_H
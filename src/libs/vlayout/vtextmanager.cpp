@@ -82,19 +82,22 @@ QMap<QString, QString> PreparePlaceholders(const VAbstractPattern *doc)
     placeholders.insert(pl_pFileName, QFileInfo(qApp->GetPPath()).baseName());
     placeholders.insert(pl_mFileName, QFileInfo(doc->MPath()).baseName());
 
+    const VContainer *data = doc->GetPatternData();
+    SCASSERT(data != nullptr)
+
     QString curSize;
     QString curHeight;
     QString mExt;
     if (qApp->patternType() == MeasurementsType::Multisize)
     {
-        curSize = QString::number(VContainer::size());
-        curHeight = QString::number(VContainer::height());
+        curSize = QString::number(data->size());
+        curHeight = QString::number(data->height());
         mExt = "vst";
     }
     else if (qApp->patternType() == MeasurementsType::Individual)
     {
-        curSize = QString::number(VContainer::size());
-        curHeight = QString::number(VContainer::height());
+        curSize = QString::number(data->size());
+        curHeight = QString::number(data->height());
         mExt = "vit";
     }
 
@@ -109,6 +109,9 @@ const QString SINGLE_OPTION_GAPWIDTH        = QStringLiteral("G");
 const QString LONG_OPTION_GROUPPING         = QStringLiteral("groups");
 const QString SINGLE_OPTION_GROUPPING       = QStringLiteral("g");
 
+const QString LONG_OPTION_ATTEMPTS          = QStringLiteral("attempts");
+const QString LONG_OPTION_TIMEBUDGET        = QStringLiteral("timebudget");
+
 const QString LONG_OPTION_TEST              = QStringLiteral("test");
 const QString SINGLE_OPTION_TEST            = QStringLiteral("t");
 
@@ -118,6 +121,9 @@ const QString SINGLE_OPTION_GRADATIONSIZE   = QStringLiteral("x");
 const QString LONG_OPTION_GRADATIONHEIGHT   = QStringLiteral("gheight");
 const QString SINGLE_OPTION_GRADATIONHEIGHT = QStringLiteral("e");
 
+const QString LONG_OPTION_GRADATIONSIZES    = QStringLiteral("gsizes");
+const QString LONG_OPTION_GRADATIONHEIGHTS  = QStringLiteral("gheights");
+
 const QString LONG_OPTION_IGNORE_MARGINS    = QStringLiteral("ignoremargins");
 const QString SINGLE_OPTION_IGNORE_MARGINS  = QStringLiteral("i");
 
@@ -154,9 +160,13 @@ QStringList AllKeys()
          << LONG_OPTION_SHIFTUNITS << SINGLE_OPTION_SHIFTUNITS
          << LONG_OPTION_GAPWIDTH << SINGLE_OPTION_GAPWIDTH
          << LONG_OPTION_GROUPPING << SINGLE_OPTION_GROUPPING
+         << LONG_OPTION_ATTEMPTS
+         << LONG_OPTION_TIMEBUDGET
          << LONG_OPTION_TEST << SINGLE_OPTION_TEST
          << LONG_OPTION_GRADATIONSIZE << SINGLE_OPTION_GRADATIONSIZE
          << LONG_OPTION_GRADATIONHEIGHT << SINGLE_OPTION_GRADATIONHEIGHT
+         << LONG_OPTION_GRADATIONSIZES
+         << LONG_OPTION_GRADATIONHEIGHTS
          << LONG_OPTION_IGNORE_MARGINS << SINGLE_OPTION_IGNORE_MARGINS
          << LONG_OPTION_LEFT_MARGIN << SINGLE_OPTION_LEFT_MARGIN
          << LONG_OPTION_RIGHT_MARGIN << SINGLE_OPTION_RIGHT_MARGIN
@@ -106,6 +106,9 @@ extern const QString SINGLE_OPTION_GAPWIDTH;
 extern const QString LONG_OPTION_GROUPPING;
 extern const QString SINGLE_OPTION_GROUPPING;
 
+extern const QString LONG_OPTION_ATTEMPTS;
+extern const QString LONG_OPTION_TIMEBUDGET;
+
 extern const QString LONG_OPTION_TEST;
 extern const QString SINGLE_OPTION_TEST;
 
@@ -115,6 +118,9 @@ extern const QString SINGLE_OPTION_GRADATIONSIZE;
 extern const QString LONG_OPTION_GRADATIONHEIGHT;
 extern const QString SINGLE_OPTION_GRADATIONHEIGHT;
 
+extern const QString LONG_OPTION_GRADATIONSIZES;
+extern const QString LONG_OPTION_GRADATIONHEIGHTS;
+
 extern const QString LONG_OPTION_IGNORE_MARGINS;
 extern const QString SINGLE_OPTION_IGNORE_MARGINS;
 
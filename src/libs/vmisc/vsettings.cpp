@@ -76,6 +76,8 @@ const QString settingPathsPattern = QStringLiteral("paths/pattern");
 const QString settingPathsLayout  = QStringLiteral("paths/layout");
 
 const QString settingPatternGraphicalOutput = QStringLiteral("pattern/graphicalOutput");
+const QString settingPatternIncrementalParse = QStringLiteral("pattern/incrementalParse");
+const QString settingPatternVerifyIncrementalParse = QStringLiteral("pattern/verifyIncrementalParse");
 
 const QString settingCommunityServer       = QStringLiteral("community/server");
 const QString settingCommunityServerSecure = QStringLiteral("community/serverSecure");
@@ -130,6 +132,20 @@ void VSettings::SetLabelLanguage(const QString &value)
     setValue(settingConfigurationLabelLanguage, value);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QStringList VSettings::LabelLanguages()
+{
+    QStringList list = QStringList() << "de" // German
+                                     << "en" // English
+                                     << "fr" // French
+                                     << "ru" // Russian
+                                     << "uk" // Ukrainian
+                                     << "hr" // Croatian
+                                     << "sr" // Serbian
+                                     << "bs"; // Bosnian
+    return list;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetDefPathPattern()
 {
@@ -184,6 +200,38 @@ void VSettings::SetGraphicalOutput(const bool &value)
     setValue(settingPatternGraphicalOutput, value);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsIncrementalParse after editing a tool recalculate only tools that depend on it. If false every change
+ * reparses whole pattern. On by default.
+ */
+bool VSettings::IsIncrementalParse() const
+{
+    return value(settingPatternIncrementalParse, 1).toBool();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSettings::SetIncrementalParse(bool value)
+{
+    setValue(settingPatternIncrementalParse, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsVerifyIncrementalParse after incremental recalculation reparse whole pattern and report differences.
+ * Debugging option.
+ */
+bool VSettings::IsVerifyIncrementalParse() const
+{
+    return value(settingPatternVerifyIncrementalParse, 0).toBool();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSettings::SetVerifyIncrementalParse(bool value)
+{
+    setValue(settingPatternVerifyIncrementalParse, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetServer() const
 {
@@ -74,6 +74,7 @@ class VSettings : public VCommonSettings
 
     QString  GetLabelLanguage() const;
     void     SetLabelLanguage(const QString &value);
+    static QStringList LabelLanguages();
 
     static QString GetDefPathPattern();
     QString GetPathPattern() const;
@@ -86,6 +87,12 @@ class VSettings : public VCommonSettings
     bool GetGraphicalOutput() const;
     void SetGraphicalOutput(const bool &value);
 
+    bool IsIncrementalParse() const;
+    void SetIncrementalParse(bool value);
+
+    bool IsVerifyIncrementalParse() const;
+    void SetVerifyIncrementalParse(bool value);
+
     QString GetServer() const;
     void SetServer(const QString &value);
 
@@ -59,7 +59,228 @@
 #include "../vmisc/def.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "variables/vinternalvariable.h"
+#include "variables/vincrement.h"
+#include "variables/vmeasurement.h"
+#include <QCoreApplication>
+#include <QScopedPointer>
 #include <QSharedPointer>
+#include <QThreadStorage>
+
+namespace
+{
+// Each compiled formula keeps a complete parser with own tables of functions, operators and character sets. The
+// tables outweigh the bytecode of any formula, so cost of an entry is a fixed parser cost plus the length of formula.
+// Cache keeps about 256 parsers per thread, the least recently used formulas go first.
+const int parserCost = 1024;
+const int maxFormulaCacheCost = 256 * parserCost;
+
+struct VariableResolver
+{
+    VariableResolver(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, CompiledFormula *compiled)
+        : vars(vars),
+          compiled(compiled),
+          unknown()
+    {}
+
+    const QHash<QString, QSharedPointer<VInternalVariable> > *vars;
+    CompiledFormula *compiled;
+    QStringList unknown;
+};
+
+struct BulkVariableResolver
+{
+    BulkVariableResolver(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QVector<qreal> &sizes,
+                         const QVector<qreal> &heights, QStringList &increments)
+        : vars(vars),
+          sizes(sizes),
+          heights(heights),
+          increments(increments),
+          columns(),
+          unknown(),
+          unsupported()
+    {}
+
+    const QHash<QString, QSharedPointer<VInternalVariable> > *vars;
+    const QVector<qreal> &sizes;
+    const QVector<qreal> &heights;
+    // Increments being evaluated at the moment, protects from circular references.
+    QStringList &increments;
+    // Parser keeps pointers to the data of columns. Data of a QVector doesn't move when the list grows.
+    QList<QVector<qreal>> columns;
+    QStringList unknown;
+    // Variables that have no value for other sizes and heights.
+    QStringList unsupported;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ThrowUnresolved throw parser error for the first of names in formula.
+ */
+Q_NORETURN void ThrowUnresolved(const QMap<int, QString> &tokens, const QStringList &names, const QString &formula,
+                                const QString &message = QString())
+{
+    int position = -1;
+    QString token = names.first();
+
+    QMap<int, QString>::const_iterator i = tokens.constBegin();
+    while (i != tokens.constEnd())
+    {
+        if (names.contains(i.value()))
+        {
+            position = i.key();
+            token = i.value();
+            break;
+        }
+        ++i;
+    }
+
+    if (message.isEmpty())
+    {
+        throw qmu::QmuParserError (qmu::ecUNASSIGNABLE_TOKEN, token, formula, position);
+    }
+
+    qmu::QmuParserError error(message.arg(token), position, token);
+    error.SetFormula(formula);
+    throw error;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BindValues copy current values of variables to slots of compiled formula.
+ * @param vars list of variables.
+ * @return false if one of variables is missing, formula must be parsed again to get correct error.
+ */
+bool CompiledFormula::BindValues(const QHash<QString, QSharedPointer<VInternalVariable> > *vars)
+{
+    for (int i = 0; i < names.size(); ++i)
+    {
+        const QSharedPointer<VInternalVariable> variable = vars->value(names.at(i));
+        if (variable.isNull())
+        {
+            return false;
+        }
+        values[i] = *variable->GetValue();
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResolveVariable variable factory. Binds variable to a slot of compiled formula with current value.
+ *
+ * Names that are not variables are remembered as unknown. Built-in functions are not errors, same as before.
+ */
+qreal *Calculator::ResolveVariable(const QString &name, void *userData)
+{
+    VariableResolver *resolver = static_cast<VariableResolver *>(userData);
+    SCASSERT(resolver != nullptr)
+
+    const QSharedPointer<VInternalVariable> variable = resolver->vars->value(name);
+    if (variable.isNull())
+    {
+        if (not builInFunctions.contains(name))
+        {
+            resolver->unknown.append(name);
+        }
+        return AddVariable(name, nullptr);
+    }
+
+    CompiledFormula *compiled = resolver->compiled;
+    Q_ASSERT(compiled->values.size() < compiled->values.capacity());
+    compiled->names.append(name);
+    compiled->values.append(*variable->GetValue());
+    return compiled->values.data() + compiled->values.size() - 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResolveBulkVariable variable factory for bulk mode. Binds variable to an array with one value per
+ * size/height combination.
+ *
+ * Multisize measurements get value for each combination, increments are evaluated for each combination from own
+ * formula. Lengths, angles and radiuses come from pattern geometry that was built for the current size and height
+ * only, such variables are not supported.
+ */
+qreal *Calculator::ResolveBulkVariable(const QString &name, void *userData)
+{
+    BulkVariableResolver *resolver = static_cast<BulkVariableResolver *>(userData);
+    SCASSERT(resolver != nullptr)
+
+    const int count = resolver->sizes.size();
+    QVector<qreal> column(count, 0);
+
+    const QSharedPointer<VInternalVariable> variable = resolver->vars->value(name);
+    if (variable.isNull())
+    {
+        if (not builInFunctions.contains(name))
+        {
+            resolver->unknown.append(name);
+        }
+    }
+    else if (variable->GetType() == VarType::Measurement)
+    {
+        const QSharedPointer<VMeasurement> measurement = variable.staticCast<VMeasurement>();
+        for (int i = 0; i < count; ++i)
+        {
+            column[i] = measurement->GetValueAt(resolver->sizes.at(i), resolver->heights.at(i));
+        }
+    }
+    else if (variable->GetType() == VarType::Increment)
+    {
+        const QSharedPointer<VIncrement> increment = variable.staticCast<VIncrement>();
+        if (not increment->IsFormulaOk())
+        {
+            column.fill(*increment->GetValue());
+        }
+        else if (resolver->increments.contains(name))
+        {
+            resolver->unsupported.append(name);
+        }
+        else
+        {
+            // Errors can't leave the factory, the parser must be reset first
+            try
+            {
+                QString formula = increment->GetFormula();
+                formula.replace("\n", " ");
+                resolver->increments.append(name);
+                column = Calculator().EvalBulk(resolver->vars, formula, resolver->sizes, resolver->heights,
+                                               resolver->increments);
+                resolver->increments.removeLast();
+            }
+            catch (const qmu::QmuParserError &)
+            {
+                resolver->increments.removeLast();
+                resolver->unsupported.append(name);
+                column.fill(0);
+            }
+        }
+    }
+    else
+    {
+        resolver->unsupported.append(name);
+    }
+
+    resolver->columns.append(column);
+    return resolver->columns.last().data();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief formulaCache return compiled formulas of the current thread. Compiled formula keeps values of variables in
+ * own slots, so it can't be shared between threads. Each thread has own cache and never waits for others.
+ */
+QCache<QString, CompiledFormula> *Calculator::formulaCache()
+{
+    static QThreadStorage<QCache<QString, CompiledFormula> *> caches;
+    if (not caches.hasLocalData())
+    {
+        caches.setLocalData(new QCache<QString, CompiledFormula>(maxFormulaCacheCost));
+    }
+    return caches.localData();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief Calculator class wraper for QMuParser. Make easy initialization math parser.
@@ -87,80 +308,108 @@ Calculator::Calculator()
 /**
  * @brief eval calculate formula.
  *
- * First we try eval expression without adding variables. If it fail, we take tokens from expression and add variables
- * to parser and try again.
+ * Parsed formulas are cached by text, each thread has own cache. If formula was already evaluated we only pass current
+ * values of variables to compiled bytecode. Otherwise parser reads the expression, binds each variable when meets it
+ * first time and evaluates the expression.
  *
  * @param formula string of formula.
  * @return value of formula.
  */
 qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula)
 {
-    // Parser doesn't know any variable on this stage. So, we just use variable factory that for each unknown variable
-    // set value to 0.
-    SetVarFactory(AddVariable, this);
-    SetSepForEval();//Reset separators options
+    QCache<QString, CompiledFormula> *cache = formulaCache();
 
-    SetExpr(formula);
+    CompiledFormula *cached = cache->object(formula);
+    if (cached != nullptr && cached->BindValues(vars))
+    {
+        return cached->parser->Eval();
+    }
 
-    qreal result = 0;
-    result = Eval();
+    QScopedPointer<CompiledFormula> compiled(new CompiledFormula());
+    compiled->parser = QSharedPointer<Calculator>(new Calculator());
+    // Slots are bound by address and must not move. Formula can't contain more variables than characters.
+    compiled->values.reserve(formula.size());
 
-    QMap<int, QString> tokens = this->GetTokens();
+    Calculator *parser = compiled->parser.data();
+    VariableResolver resolver(vars, compiled.data());
 
-    // Remove "-" from tokens list if exist. If don't do that unary minus operation will broken.
-    RemoveAll(tokens, QStringLiteral("-"));
+    // Variables are resolved while parser reads the expression, so formula is evaluated only once.
+    parser->SetVarFactory(ResolveVariable, &resolver);
+    parser->SetSepForEval();//Reset separators options
+    parser->SetExpr(formula);
 
-    for (int i = 0; i < builInFunctions.size(); ++i)
-    {
-        if (tokens.isEmpty())
-        {
-            break;
-        }
-        RemoveAll(tokens, builInFunctions.at(i));
-    }
+    const qreal result = parser->Eval();
 
-    if (tokens.isEmpty())
+    // Resolver lives only during this call.
+    parser->SetVarFactory(AddVariable, parser);
+
+    if (not resolver.unknown.isEmpty())
     {
-        return result; // We have found only numbers in expression.
+        ThrowUnresolved(parser->GetTokens(), resolver.unknown, formula);
     }
 
-    // Add variables to parser because we have deal with expression with variables.
-    InitVariables(vars, tokens, formula);
-    return Eval();
+    cache->insert(formula, compiled.take(), parserCost + formula.size());
+    return result;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Calculator::InitVariables add variables to parser.
+ * @brief EvalFormula calculate formula for several size/height combinations at once.
  *
- * For optimization purpose we try don't add variables that we don't need.
+ * Each variable becomes an array with one value per combination and formula is evaluated by bulk mode of the parser.
+ * Parser compiles the formula once and runs the bytecode over arrays. Formula may use measurements and increments.
+ * Formula that uses lengths, angles or radiuses of pattern objects throws an error, their values are known only for
+ * the current size and height.
  *
  * @param vars list of variables.
- * @param tokens all tokens (measurements names, variables with lengths) that parser have found in expression.
- * @param formula expression, need for throwing better error message.
+ * @param formula string of formula.
+ * @param sizes sizes of combinations in pattern units.
+ * @param heights heights of combinations in pattern units, must have the same length as sizes.
+ * @return value of formula for each combination.
  */
-void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
-                               const QMap<int, QString> &tokens, const QString &formula)
+QVector<qreal> Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+                                       const QString &formula, const QVector<qreal> &sizes,
+                                       const QVector<qreal> &heights)
 {
-    QMap<int, QString>::const_iterator i = tokens.constBegin();
-    while (i != tokens.constEnd())
+    QStringList increments;
+    return EvalBulk(vars, formula, sizes, heights, increments);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<qreal> Calculator::EvalBulk(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+                                    const QString &formula, const QVector<qreal> &sizes, const QVector<qreal> &heights,
+                                    QStringList &increments)
+{
+    SCASSERT(sizes.size() == heights.size())
+
+    QVector<qreal> results(sizes.size(), 0);
+    if (results.isEmpty())
     {
-        bool found = false;
-        if (vars->contains(i.value()))
-        {
-            DefineVar(i.value(), vars->value(i.value())->GetValue());
-            found = true;
-        }
+        return results;
+    }
 
-        if (found == false && builInFunctions.contains(i.value()))
-        {// We have found built-in function
-            found = true;
-        }
+    BulkVariableResolver resolver(vars, sizes, heights, increments);
 
-        if (found == false)
-        {
-            throw qmu::QmuParserError (qmu::ecUNASSIGNABLE_TOKEN, i.value(), formula, i.key());
-        }
-        ++i;
+    SetVarFactory(ResolveBulkVariable, &resolver);
+    SetSepForEval();//Reset separators options
+    SetExpr(formula);
+
+    Eval(results.data(), results.size());
+
+    // Resolver lives only during this call.
+    SetVarFactory(AddVariable, this);
+
+    if (not resolver.unknown.isEmpty())
+    {
+        ThrowUnresolved(GetTokens(), resolver.unknown, formula);
     }
+
+    if (not resolver.unsupported.isEmpty())
+    {
+        ThrowUnresolved(GetTokens(), resolver.unsupported, formula,
+                        QCoreApplication::translate("Calculator", "Value of \"%1\" is known only for the current size "
+                                                                  "and height"));
+    }
+
+    return results;
 }
@@ -53,15 +53,36 @@
 #define CALCULATOR_H
 
 #include <qcompilerdetection.h>
+#include <QCache>
 #include <QHash>
 #include <QMap>
+#include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QVector>
 #include <QtGlobal>
 
 #include "../qmuparser/qmuformulabase.h"
 
 //class VInternalVariable;
 #include "variables/vinternalvariable.h"
+
+class Calculator;
+
+/**
+ * @brief The CompiledFormula struct keeps parser with compiled bytecode of one formula.
+ *
+ * Variables are bound to own slots. Before each evaluation slots receive current values of variables.
+ */
+struct CompiledFormula
+{
+    QSharedPointer<Calculator> parser;
+    QStringList                names;
+    QVector<qreal>             values;
+
+    bool BindValues(const QHash<QString, QSharedPointer<VInternalVariable> > *vars);
+};
+
 /**
  * @brief The Calculator class for calculation formula.
  *
@@ -87,11 +108,18 @@ class Calculator:public qmu::QmuFormulaBase
     virtual ~Calculator() Q_DECL_EQ_DEFAULT;
 
     qreal EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula);
+    QVector<qreal> EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula,
+                               const QVector<qreal> &sizes, const QVector<qreal> &heights);
 private:
     Q_DISABLE_COPY(Calculator)
 
-    void InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QMap<int, QString> &tokens,
-                       const QString &formula);
+    static QCache<QString, CompiledFormula> *formulaCache();
+
+    QVector<qreal> EvalBulk(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula,
+                            const QVector<qreal> &sizes, const QVector<qreal> &heights, QStringList &increments);
+
+    static qreal *ResolveVariable(const QString &name, void *userData);
+    static qreal *ResolveBulkVariable(const QString &name, void *userData);
 };
 
 #endif // CALCULATOR_H
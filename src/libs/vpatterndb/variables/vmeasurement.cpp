@@ -253,6 +253,23 @@ qreal VMeasurement::CalcValue() const
         return VInternalVariable::GetValue();
     }
 
+    return GetValueAt(*d->currentSize, *d->currentHeight);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetValueAt value of the measurement for any size and height, current size and height stay unchanged.
+ * @param size size in pattern units.
+ * @param height height in pattern units.
+ * @return value for multisize measurement, own value for individual measurement.
+ */
+qreal VMeasurement::GetValueAt(qreal size, qreal height) const
+{
+    if (d->currentUnit == nullptr)
+    {
+        return VInternalVariable::GetValue();
+    }
+
     if (*d->currentUnit == Unit::Inch)
     {
         qWarning("Gradation doesn't support inches");
@@ -263,8 +280,8 @@ qreal VMeasurement::CalcValue() const
     const qreal heightIncrement = UnitConvertor(6.0, Unit::Cm, *d->currentUnit);
 
     // Formula for calculation gradation
-    const qreal k_size    = ( *d->currentSize - d->baseSize ) / sizeIncrement;
-    const qreal k_height  = ( *d->currentHeight - d->baseHeight ) / heightIncrement;
+    const qreal k_size    = ( size - d->baseSize ) / sizeIncrement;
+    const qreal k_height  = ( height - d->baseHeight ) / heightIncrement;
     return d->base + k_size * d->ksize + k_height * d->kheight;
 }
 
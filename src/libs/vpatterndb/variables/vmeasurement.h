@@ -107,6 +107,8 @@ class VMeasurement :public VVariable
     virtual qreal  GetValue() const Q_DECL_OVERRIDE;
     virtual qreal* GetValue() Q_DECL_OVERRIDE;
 
+    qreal          GetValueAt(qreal size, qreal height) const;
+
     VContainer *GetData();
 
     void SetSize(qreal *size);
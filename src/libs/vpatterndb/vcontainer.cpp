@@ -52,6 +52,7 @@
 #include "vcontainer.h"
 
 #include <limits.h>
+#include <QMutexLocker>
 #include <QVector>
 #include <QtDebug>
 
@@ -86,11 +87,6 @@ Q_LOGGING_CATEGORY(vCon, "v.container")
 
 QT_WARNING_POP
 
-quint32 VContainer::_id = NULL_ID;
-qreal VContainer::_size = 50;
-qreal VContainer::_height = 176;
-QSet<QString> VContainer::uniqueNames = QSet<QString>();
-
 #ifdef Q_COMPILER_RVALUE_REFS
 VContainer &VContainer::operator=(VContainer &&data) Q_DECL_NOTHROW
 { Swap(data); return *this; }
@@ -216,7 +212,7 @@ quint32 VContainer::AddGObject(VGObject *obj)
 {
     SCASSERT(obj != nullptr)
     QSharedPointer<VGObject> pointer(obj);
-    uniqueNames.insert(obj->name());
+    InsertUniqueName(obj->name());
     return AddObject(d->gObjects, pointer);
 }
 
@@ -237,9 +233,11 @@ quint32 VContainer::AddPiecePath(const VPiecePath &path)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-quint32 VContainer::getId()
+quint32 VContainer::getId() const
 {
-    return _id;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    return state->id;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -252,12 +250,14 @@ quint32 VContainer::getNextId()
     //TODO. Current count of ids are very big and allow us save time before someone will reach its max value.
     //Better way, of cource, is to seek free ids inside the set of values and reuse them.
     //But for now better to keep it as it is now.
-    if (_id == UINT_MAX)
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    if (state->id == UINT_MAX)
     {
         qCritical()<<(tr("Number of free id exhausted."));
     }
-    _id++;
-    return _id;
+    state->id++;
+    return state->id;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -267,9 +267,11 @@ quint32 VContainer::getNextId()
  */
 void VContainer::UpdateId(quint32 newId)
 {
-    if (newId > _id)
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    if (newId > state->id)
     {
-       _id = newId;
+       state->id = newId;
     }
 }
 
@@ -280,7 +282,7 @@ void VContainer::UpdateId(quint32 newId)
 void VContainer::Clear()
 {
     qCDebug(vCon, "Clearing container data.");
-    _id = NULL_ID;
+    ResetId();
 
     d->pieces->clear();
     d->piecePaths->clear();
@@ -293,7 +295,7 @@ void VContainer::Clear()
 void VContainer::ClearForFullParse()
 {
     qCDebug(vCon, "Clearing container data for full parse.");
-    _id = NULL_ID;
+    ResetId();
 
     d->pieces->clear();
     d->piecePaths->clear();
@@ -521,6 +523,98 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
     UpdateId(id);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshFrom take from data new values of the objects and variables this container already has.
+ *
+ * Objects and variables data has but this container doesn't are not added. This way a data copy of a tool gets new
+ * values, but still knows only about objects that existed when the tool was created.
+ * @param data container with new values.
+ * @param toolId if set, objects of this tool are taken even if this container doesn't have them yet. Editing a tool
+ * can give it new objects.
+ */
+void VContainer::RefreshFrom(const VContainer &data, quint32 toolId)
+{
+    for (auto i = d->gObjects.begin(); i != d->gObjects.end(); ++i)
+    {
+        const auto object = data.d->gObjects.constFind(i.key());
+        if (object != data.d->gObjects.constEnd())
+        {
+            i.value() = object.value();
+        }
+    }
+
+    for (auto i = d->variables.begin(); i != d->variables.end(); ++i)
+    {
+        const auto variable = data.d->variables.constFind(i.key());
+        if (variable != data.d->variables.constEnd())
+        {
+            i.value() = variable.value();
+        }
+    }
+
+    if (toolId != NULL_ID)
+    {
+        for (auto i = data.d->gObjects.constBegin(); i != data.d->gObjects.constEnd(); ++i)
+        {
+            if (i.value()->getIdTool() == toolId)
+            {
+                d->gObjects.insert(i.key(), i.value());
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshFrom take from data new values of the listed objects and variables this container already has.
+ *
+ * Only listed keys are visited, so the cost doesn't depend on size of the pattern. A container that has none of them is
+ * left untouched and doesn't detach.
+ * @param data container with new values.
+ * @param objects ids of changed objects.
+ * @param variables names of changed variables.
+ * @return true if this container had any of the objects or variables.
+ */
+bool VContainer::RefreshFrom(const VContainer &data, const QSet<quint32> &objects, const QSet<QString> &variables)
+{
+    const VContainerData *current = d.constData();
+    bool holds = false;
+    for (auto i = objects.constBegin(); i != objects.constEnd() && not holds; ++i)
+    {
+        holds = current->gObjects.contains(*i);
+    }
+
+    for (auto i = variables.constBegin(); i != variables.constEnd() && not holds; ++i)
+    {
+        holds = current->variables.contains(*i);
+    }
+
+    if (not holds)
+    {
+        return false;
+    }
+
+    for (auto i = objects.constBegin(); i != objects.constEnd(); ++i)
+    {
+        const auto object = data.d->gObjects.constFind(*i);
+        if (object != data.d->gObjects.constEnd() && d.constData()->gObjects.contains(*i))
+        {
+            d->gObjects.insert(*i, object.value());
+        }
+    }
+
+    for (auto i = variables.constBegin(); i != variables.constEnd(); ++i)
+    {
+        const auto variable = data.d->variables.constFind(*i);
+        if (variable != data.d->variables.constEnd() && d.constData()->variables.contains(*i))
+        {
+            d->variables.insert(*i, variable.value());
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief removeCustomVariable remove increment by name from increment table
@@ -581,16 +675,20 @@ const QMap<QString, QSharedPointer<VCurveAngle> > VContainer::curveAnglesData()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VContainer::IsUnique(const QString &name)
+bool VContainer::IsUnique(const QString &name) const
 {
-    return (!uniqueNames.contains(name) && !builInFunctions.contains(name));
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    return (!state->uniqueNames.contains(name) && !builInFunctions.contains(name));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QStringList VContainer::AllUniqueNames()
+QStringList VContainer::AllUniqueNames() const
 {
     QStringList names = builInFunctions;
-	names.append(uniqueNames.values());
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+	names.append(state->uniqueNames.values());
     return names;
 }
 
@@ -627,20 +725,24 @@ const QMap<QString, QSharedPointer<T> > VContainer::DataVar(const VarType &type)
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::ClearUniqueNames()
 {
-    uniqueNames.clear();
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    state->uniqueNames.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::ClearUniqueIncrementNames()
 {
-	const QList<QString> list = uniqueNames.values();
-    ClearUniqueNames();
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+	const QList<QString> list = state->uniqueNames.values();
+    state->uniqueNames.clear();
 
     for(int i = 0; i < list.size(); ++i)
     {
         if (not list.at(i).startsWith('#'))
         {
-            uniqueNames.insert(list.at(i));
+            state->uniqueNames.insert(list.at(i));
         }
     }
 }
@@ -652,7 +754,9 @@ void VContainer::ClearUniqueIncrementNames()
  */
 void VContainer::SetSize(qreal size)
 {
-    _size = size;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    state->size = size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -662,7 +766,9 @@ void VContainer::SetSize(qreal size)
  */
 void VContainer::SetHeight(qreal height)
 {
-    _height = height;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    state->height = height;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -670,15 +776,21 @@ void VContainer::SetHeight(qreal height)
  * @brief size return size
  * @return size in mm
  */
-qreal VContainer::size()
+qreal VContainer::size() const
 {
-    return _size;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    return state->size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-qreal *VContainer::rsize()
+/**
+ * @brief rsize return pointer to size in the state shared by all copies of the container. Reading through the pointer
+ * is not guarded, see VContainerState.
+ */
+qreal *VContainer::rsize() const
 {
-    return &_size;
+    return &State()->size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -686,15 +798,47 @@ qreal *VContainer::rsize()
  * @brief height return height
  * @return height in pattern units
  */
-qreal VContainer::height()
+qreal VContainer::height() const
+{
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    return state->height;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief rheight return pointer to height in the state shared by all copies of the container. Reading through the
+ * pointer is not guarded, see VContainerState.
+ */
+qreal *VContainer::rheight() const
+{
+    return &State()->height;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief State return state of pattern evaluation. Doesn't detach data, the state is shared by all copies. Lock
+ * VContainerState::mutex before access.
+ */
+VContainerState *VContainer::State() const
+{
+    return d->state.data();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VContainer::InsertUniqueName(const QString &name) const
 {
-    return _height;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    state->uniqueNames.insert(name);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-qreal *VContainer::rheight()
+void VContainer::ResetId()
 {
-    return &_height;
+    VContainerState *state = State();
+    QMutexLocker locker(&state->mutex);
+    state->id = NULL_ID;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
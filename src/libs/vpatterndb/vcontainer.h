@@ -57,6 +57,7 @@
 #include <QHash>
 #include <QMap>
 #include <QMessageLogger>
+#include <QMutex>
 #include <QSet>
 #include <QSharedPointer>
 #include <QSharedData>
@@ -82,6 +83,39 @@
 
 class VEllipticalArc;
 
+/**
+ * @brief The VContainerState struct state of one pattern evaluation. Shared by all copies of a container, like the
+ * static members it replaced, but not between different patterns, so several patterns can be evaluated at the same
+ * time on different threads.
+ *
+ * Copies of a container may live on different threads, VContainer locks the mutex on each access. The only exception
+ * are pointers returned by VContainer::rsize() and VContainer::rheight(). They point into this shared state, so size
+ * and height must not change while formulas of the pattern are evaluated.
+ */
+struct VContainerState
+{
+    VContainerState()
+        : mutex(),
+          id(NULL_ID),
+          size(50),
+          height(176),
+          uniqueNames()
+    {}
+
+    QMutex mutex;
+
+    /**
+     * @brief id current id. New object will have value +1. For empty class equal 0.
+     */
+    quint32       id;
+    qreal         size;
+    qreal         height;
+    QSet<QString> uniqueNames;
+
+private:
+    Q_DISABLE_COPY(VContainerState)
+};
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_INTEL(2021)
@@ -97,7 +131,8 @@ class VContainerData : public QSharedData //-V690
           pieces(QSharedPointer<QHash<quint32, VPiece>>(new QHash<quint32, VPiece>())),
           piecePaths(QSharedPointer<QHash<quint32, VPiecePath>>(new QHash<quint32, VPiecePath>())),
           trVars(trVars),
-          patternUnit(patternUnit)
+          patternUnit(patternUnit),
+          state(QSharedPointer<VContainerState>(new VContainerState()))
     {}
 
     VContainerData(const VContainerData &data)
@@ -107,7 +142,8 @@ class VContainerData : public QSharedData //-V690
           pieces(data.pieces),
           piecePaths(data.piecePaths),
           trVars(data.trVars),
-          patternUnit(data.patternUnit)
+          patternUnit(data.patternUnit),
+          state(data.state)
     {}
 
     virtual ~VContainerData();
@@ -128,6 +164,8 @@ class VContainerData : public QSharedData //-V690
     const VTranslateVars *trVars;
     const Unit *patternUnit;
 
+    QSharedPointer<VContainerState> state;
+
 private:
     VContainerData &operator=(const VContainerData &) Q_DECL_EQ_DELETE;
 };
@@ -160,9 +198,9 @@ class VContainer
     VPiecePath         GetPiecePath(quint32 id) const;
     template <typename T>
     QSharedPointer<T>  GetVariable(QString name) const;
-    static quint32     getId();
-    static quint32     getNextId();
-    static void        UpdateId(quint32 newId);
+    quint32            getId() const;
+    quint32            getNextId();
+    void               UpdateId(quint32 newId);
 
     quint32            AddGObject(VGObject *obj);
     quint32            AddPiece(const VPiece &detail);
@@ -188,21 +226,24 @@ class VContainer
 
     void               UpdatePiece(quint32 id, const VPiece &detail);
     void               UpdatePiecePath(quint32 id, const VPiecePath &path);
+    void               RefreshFrom(const VContainer &data, quint32 toolId = NULL_ID);
+    bool               RefreshFrom(const VContainer &data, const QSet<quint32> &objects,
+                                   const QSet<QString> &variables);
 
     void               Clear();
     void               ClearForFullParse();
     void               ClearGObjects();
     void               ClearCalculationGObjects();
     void               ClearVariables(const VarType &type = VarType::Unknown);
-    static void        ClearUniqueNames();
-    static void        ClearUniqueIncrementNames();
+    void               ClearUniqueNames();
+    void               ClearUniqueIncrementNames();
 
-    static void        SetSize(qreal size);
-    static void        SetHeight(qreal height);
-    static qreal       size();
-    static qreal      *rsize();
-    static qreal       height();
-    static qreal      *rheight();
+    void               SetSize(qreal size);
+    void               SetHeight(qreal height);
+    qreal              size() const;
+    qreal             *rsize() const;
+    qreal              height() const;
+    qreal             *rheight() const;
 
     void               removeCustomVariable(const QString& name);
 
@@ -219,23 +260,19 @@ class VContainer
     const QMap<QString, QSharedPointer<VArcRadius> >    arcRadiusesData() const;
     const QMap<QString, QSharedPointer<VCurveAngle> >   curveAnglesData() const;
 
-    static bool        IsUnique(const QString &name);
-    static QStringList AllUniqueNames();
+    bool               IsUnique(const QString &name) const;
+    QStringList        AllUniqueNames() const;
 
     const Unit *GetPatternUnit() const;
     const VTranslateVars *GetTrVars() const;
 
 private:
-    /**
-     * @brief _id current id. New object will have value +1. For empty class equal 0.
-     */
-    static quint32 _id;
-    static qreal   _size;
-    static qreal   _height;
-    static QSet<QString> uniqueNames;
-
     QSharedDataPointer<VContainerData> d;
 
+    VContainerState *State() const;
+    void             InsertUniqueName(const QString &name) const;
+    void             ResetId();
+
     void AddCurve(const QSharedPointer<VAbstractCurve> &curve, const quint32 &id, quint32 parentId = NULL_ID);
 
     template <class T>
@@ -249,7 +286,7 @@ class VContainer
     void UpdateObject(const quint32 &id, const QSharedPointer<T> &point);
 
     template <typename key, typename val>
-    static quint32 AddObject(QHash<key, val> &obj, val value);
+    quint32 AddObject(QHash<key, val> &obj, val value);
 
     template <typename T>
     const QMap<QString, QSharedPointer<T> > DataVar(const VarType &type) const;
@@ -354,7 +391,7 @@ void VContainer::AddVariable(const QString& name, const QSharedPointer<T> &var)
         d->variables.insert(name, var);
     }
 
-    uniqueNames.insert(name);
+    InsertUniqueName(name);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -383,7 +420,7 @@ void VContainer::UpdateGObject(quint32 id, const QSharedPointer<T> &obj)
 {
     SCASSERT(not obj.isNull())
     UpdateObject(id, obj);
-    uniqueNames.insert(obj->name());
+    InsertUniqueName(obj->name());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -509,19 +509,22 @@ void DialogEditLabel::InitPlaceholders()
     const QString measurementsFilePath = QFileInfo(m_doc->MPath()).baseName();
     m_placeholders.insert(pl_mFileName, qMakePair(tr("Measurments file name"), measurementsFilePath));
 
+    const VContainer *data = m_doc->GetPatternData();
+    SCASSERT(data != nullptr)
+
     QString curSize;
     QString curHeight;
     QString mExt;
     if (qApp->patternType() == MeasurementsType::Multisize)
     {
-        curSize = QString::number(VContainer::size());
-        curHeight = QString::number(VContainer::height());
+        curSize = QString::number(data->size());
+        curHeight = QString::number(data->height());
         mExt = "vst";
     }
     else if (qApp->patternType() == MeasurementsType::Individual)
     {
-        curSize = QString::number(VContainer::size());
-        curHeight = QString::number(VContainer::height());
+        curSize = QString::number(data->size());
+        curHeight = QString::number(data->height());
         mExt = "vit";
     }
 
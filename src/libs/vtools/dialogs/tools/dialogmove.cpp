@@ -458,7 +458,7 @@ void DialogMove::suffixChanged()
             if (m_suffix != suffix)
             {
                 QRegularExpression rx(NameRegExp());
-                const QStringList uniqueNames = VContainer::AllUniqueNames();
+                const QStringList uniqueNames = data->AllUniqueNames();
                 for (int i=0; i < uniqueNames.size(); ++i)
                 {
                     const QString name = uniqueNames.at(i) + suffix;
@@ -172,7 +172,7 @@ void DialogPin::ShowVisualization()
 
     if (m_showMode)
     {
-        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(GetPieceId()));
+        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(qApp->getCurrentDocument()->getTool(GetPieceId()));
         SCASSERT(tool != nullptr);
         auto visPoint = qobject_cast<VisToolPin *>(vis);
         SCASSERT(visPoint != nullptr);
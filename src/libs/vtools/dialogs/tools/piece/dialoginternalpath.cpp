@@ -225,7 +225,7 @@ void DialogInternalPath::ShowVisualization()
 
     if (m_showMode)
     {
-        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(GetPieceId()));
+        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(qApp->getCurrentDocument()->getTool(GetPieceId()));
         SCASSERT(tool != nullptr);
         auto visPath = qobject_cast<VisToolInternalPath *>(vis);
         SCASSERT(visPath != nullptr);
@@ -3140,7 +3140,7 @@ void DialogSeamAllowance::ShowPins()
     {
         m_visPins->VisualMode(NULL_ID);
         m_visPins->setZValue(10); // pins should be on top
-        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(toolId));
+        VToolSeamAllowance *tool = qobject_cast<VToolSeamAllowance*>(qApp->getCurrentDocument()->getTool(toolId));
         SCASSERT(tool != nullptr);
         m_visPins->setParentItem(tool);
     }
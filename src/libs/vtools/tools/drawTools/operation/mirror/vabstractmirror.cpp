@@ -78,7 +78,7 @@ void VAbstractMirror::createDestination(Source typeCreation, quint32 &id, QVecto
     {
         dest.clear();// Try to avoid mistake, value must be empty
 
-        id = VContainer::getNextId();//Just reserve id for tool
+        id = data->getNextId();//Just reserve id for tool
 
         for (int i = 0; i < source.size(); ++i)
         {
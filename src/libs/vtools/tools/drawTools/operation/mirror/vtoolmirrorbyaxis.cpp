@@ -152,7 +152,7 @@ VToolMirrorByAxis *VToolMirrorByAxis::Create(const quint32 _id, quint32 originPo
                                                             dest, typeCreation);
         scene->addItem(tool);
         initOperationToolConnections(scene, tool);
-        VAbstractPattern::AddTool(id, tool);
+        doc->AddTool(id, tool);
         doc->IncrementReferens(originPoint.getIdTool());
         for (int i = 0; i < source.size(); ++i)
         {
@@ -146,7 +146,7 @@ VToolMirrorByLine *VToolMirrorByLine::Create(const quint32 _id, quint32 firstLin
                                                             source, dest, typeCreation);
         scene->addItem(tool);
         initOperationToolConnections(scene, tool);
-        VAbstractPattern::AddTool(id, tool);
+        doc->AddTool(id, tool);
         doc->IncrementReferens(firstPoint.getIdTool());
         doc->IncrementReferens(secondPoint.getIdTool());
         for (int i = 0; i < source.size(); ++i)
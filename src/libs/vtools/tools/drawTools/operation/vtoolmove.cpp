@@ -232,7 +232,7 @@ VToolMove *VToolMove::Create(quint32 _id, QString &formulaAngle, QString &formul
     {
         dest.clear();// Try to avoid mistake, value must be empty
 
-        id = VContainer::getNextId();//Just reserve id for tool
+        id = data->getNextId();//Just reserve id for tool
 
         qCDebug(vTool, "Create SourceItem GUI");
         for (int i = 0; i < source.size(); ++i)
@@ -364,7 +364,7 @@ QT_WARNING_POP
                                         suffix, source, dest, typeCreation);
         scene->addItem(tool);
         initOperationToolConnections(scene, tool);
-        VAbstractPattern::AddTool(id, tool);
+        doc->AddTool(id, tool);
 
         if (!originPoint.isNull())
         {
@@ -168,7 +168,7 @@ VToolRotation *VToolRotation::Create(const quint32 _id, const quint32 &origin, Q
     {
         dest.clear();// Try to avoid mistake, value must be empty
 
-        id = VContainer::getNextId();//Just reserve id for tool
+        id = data->getNextId();//Just reserve id for tool
 
         for (int i = 0; i < source.size(); ++i)
         {
@@ -268,7 +268,7 @@ QT_WARNING_POP
         VToolRotation *tool = new VToolRotation(doc, data, id, origin, angle, suffix, source, dest, typeCreation);
         scene->addItem(tool);
         initOperationToolConnections(scene, tool);
-        VAbstractPattern::AddTool(id, tool);
+        doc->AddTool(id, tool);
         doc->IncrementReferens(originPoint.getIdTool());
         for (int i = 0; i < source.size(); ++i)
         {
@@ -199,7 +199,7 @@ VToolArc* VToolArc::Create(const quint32 _id, const quint32 &center, QString &ra
         VToolArc *toolArc = new VToolArc(doc, data, id, typeCreation);
         scene->addItem(toolArc);
         InitArcToolConnections(scene, toolArc);
-        VAbstractPattern::AddTool(id, toolArc);
+        doc->AddTool(id, toolArc);
         doc->IncrementReferens(c.getIdTool());
         return toolArc;
     }
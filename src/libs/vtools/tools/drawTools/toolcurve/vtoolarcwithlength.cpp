@@ -168,7 +168,7 @@ VToolArcWithLength *VToolArcWithLength::Create(const quint32 _id, const quint32
         VToolArcWithLength *toolArc = new VToolArcWithLength(doc, data, id, typeCreation);
         scene->addItem(toolArc);
         InitArcToolConnections(scene, toolArc);
-        VAbstractPattern::AddTool(id, toolArc);
+        doc->AddTool(id, toolArc);
         doc->IncrementReferens(c.getIdTool());
         return toolArc;
     }
@@ -157,7 +157,7 @@ VToolCubicBezierPath *VToolCubicBezierPath::Create(const quint32 _id, VCubicBezi
         VToolCubicBezierPath *spl = new VToolCubicBezierPath(doc, data, id, typeCreation);
         scene->addItem(spl);
         InitSplinePathToolConnections(scene, spl);
-        VAbstractPattern::AddTool(id, spl);
+        doc->AddTool(id, spl);
         return spl;
     }
     return nullptr;
@@ -227,7 +227,7 @@ VToolSpline* VToolSpline::Create(const quint32 _id, VSpline *spline, VMainGraphi
         auto _spl = new VToolSpline(doc, data, id, typeCreation);
         scene->addItem(_spl);
         InitSplineToolConnections(scene, _spl);
-        VAbstractPattern::AddTool(id, _spl);
+        doc->AddTool(id, _spl);
         doc->IncrementReferens(spline->GetP1().getIdTool());
         doc->IncrementReferens(spline->GetP4().getIdTool());
         return _spl;
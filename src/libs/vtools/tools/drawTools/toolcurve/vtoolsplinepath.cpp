@@ -238,7 +238,7 @@ VToolSplinePath* VToolSplinePath::Create(const quint32 _id, VSplinePath *path, V
         VToolSplinePath *spl = new VToolSplinePath(doc, data, id, typeCreation);
         scene->addItem(spl);
         InitSplinePathToolConnections(scene, spl);
-        VAbstractPattern::AddTool(id, spl);
+        doc->AddTool(id, spl);
         return spl;
     }
     return nullptr;
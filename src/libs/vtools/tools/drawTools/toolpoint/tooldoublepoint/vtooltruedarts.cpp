@@ -209,7 +209,7 @@ VToolTrueDarts *VToolTrueDarts::Create(quint32 _id,
 
     if (typeCreation == Source::FromGui)
     {
-        id = VContainer::getNextId();  //Just reserve id for tool
+        id = data->getNextId();  //Just reserve id for tool
         p1id = data->AddGObject(p1);
         p2id = data->AddGObject(p2);
     }
@@ -230,7 +230,7 @@ VToolTrueDarts *VToolTrueDarts::Create(quint32 _id,
                                                     dartP1Id, dartP2Id, dartP3Id, typeCreation);
         scene->addItem(points);
         InitToolConnections(scene, points);
-        VAbstractPattern::AddTool(id, points);
+        doc->AddTool(id, points);
         doc->IncrementReferens(baseLineP1->getIdTool());
         doc->IncrementReferens(baseLineP2->getIdTool());
         doc->IncrementReferens(dartP1->getIdTool());
@@ -168,7 +168,7 @@ IntersectCirclesTool *IntersectCirclesTool::Create(const quint32 _id, const QStr
                                                                                      typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(c1Point.getIdTool());
         doc->IncrementReferens(c2Point.getIdTool());
         return point;
@@ -171,7 +171,7 @@ IntersectCircleTangentTool *IntersectCircleTangentTool::Create(const quint32 _id
                                                                                    crossPoint, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(cPoint.getIdTool());
         doc->IncrementReferens(tPoint.getIdTool());
         return point;
@@ -132,7 +132,7 @@ inline void VToolCut::ShowToolVisualization(bool show)
         delete vis;
     }
 
-    VDataTool *parent = VAbstractPattern::getTool(VAbstractTool::data.GetGObject(curveCutId)->getIdTool());
+    VDataTool *parent = doc->getTool(VAbstractTool::data.GetGObject(curveCutId)->getIdTool());
     if (VAbstractSpline *parentCurve = qobject_cast<VAbstractSpline *>(parent))
     {
         m_piecesMode ? parentCurve->ShowHandles(m_piecesMode) : parentCurve->ShowHandles(show);
@@ -353,7 +353,7 @@ VToolAlongLine* VToolAlongLine::Create(const quint32 _id, const QString &pointNa
                                    typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(firstPoint->getIdTool());
         doc->IncrementReferens(secondPoint->getIdTool());
     }
@@ -247,7 +247,7 @@ VToolBisector* VToolBisector::Create(const quint32 _id, QString &formula, quint3
                                                  secondPointId, thirdPointId, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(firstPoint->getIdTool());
         doc->IncrementReferens(secondPoint->getIdTool());
         doc->IncrementReferens(thirdPoint->getIdTool());
@@ -191,8 +191,8 @@ VToolCurveIntersectAxis *VToolCurveIntersectAxis::Create(const quint32 _id, cons
         id = data->AddGObject(p);
         data->AddLine(basePointId, id);
 
-        VContainer::getNextId();
-        VContainer::getNextId();
+        data->getNextId();
+        data->getNextId();
         InitSegments(curve->getType(), segLength, p, curveId, data);
     }
     else
@@ -215,7 +215,7 @@ VToolCurveIntersectAxis *VToolCurveIntersectAxis::Create(const quint32 _id, cons
                                                                      basePointId, curveId, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(basePoint->getIdTool());
         doc->IncrementReferens(curve->getIdTool());
         return point;
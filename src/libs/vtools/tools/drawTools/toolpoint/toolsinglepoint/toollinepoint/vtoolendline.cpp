@@ -209,7 +209,7 @@ VToolEndLine* VToolEndLine::Create(const quint32 _id, const QString &pointName,
                                                basePointId, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(basePoint->getIdTool());
         return point;
     }
@@ -212,7 +212,7 @@ VToolNormal* VToolNormal::Create(const quint32 _id, QString &formula, quint32 fi
                                              secondPointId, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(firstPoint->getIdTool());
         doc->IncrementReferens(secondPoint->getIdTool());
         return point;
@@ -68,6 +68,7 @@
 #include <QStaticStringData>
 #include <QStringData>
 #include <QStringDataPtr>
+#include <QTimer>
 #include <QUndoStack>
 #include <new>
 
@@ -94,6 +95,12 @@
 
 const QString VToolBasePoint::ToolType = QStringLiteral("single");
 
+namespace
+{
+// Recalculate the preview at most once per frame while dragging.
+const int previewInterval = 16; // msec
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief VToolBasePoint constructor.
@@ -107,7 +114,18 @@ VToolBasePoint::VToolBasePoint (VAbstractPattern *doc, VContainer *data, quint32
                                 const QString &draftBlockName, QGraphicsItem * parent )
     : VToolSinglePoint(doc, data, id, QColor(Qt::red), parent)
     , draftBlockName(draftBlockName)
+    , m_dragging(false)
+    , m_dragStartX()
+    , m_dragStartY()
+    , m_dragPos()
+    , m_previewTimer(new QTimer(this))
+    , m_previewing(false)
+    , m_previewed(false)
 {
+    m_previewTimer->setSingleShot(true);
+    m_previewTimer->setInterval(previewInterval);
+    connect(m_previewTimer, &QTimer::timeout, this, &VToolBasePoint::PreviewMove);
+
     this->setFlag(QGraphicsItem::ItemIsMovable, true);
     this->setFlag(QGraphicsItem::ItemSendsGeometryChanges, true);
     //m_pointName->setBrush(Qt::black);
@@ -154,7 +172,7 @@ VToolBasePoint *VToolBasePoint::Create(quint32 _id, const QString &activeDraftBl
         VToolBasePoint *spoint = new VToolBasePoint(doc, data, id, typeCreation, activeDraftBlock);
         scene->addItem(spoint);
         InitToolConnections(scene, spoint);
-        VAbstractPattern::AddTool(id, spoint);
+        doc->AddTool(id, spoint);
         return spoint;
     }
     return nullptr;
@@ -217,36 +235,27 @@ QVariant VToolBasePoint::itemChange(QGraphicsItem::GraphicsItemChange change, co
             // value - this is new position.
             QPointF newPos = value.toPointF();
 
-            MoveSPoint *moveSP = new MoveSPoint(doc, newPos.x(), newPos.y(), m_id, this->scene());
-            connect(moveSP, &MoveSPoint::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
-            qApp->getUndoStack()->push(moveSP);
-            const QList<QGraphicsView *> viewList = scene()->views();
-            if (not viewList.isEmpty())
+            if (m_dragging)
             {
-                if (QGraphicsView *view = viewList.at(0))
+                // While dragging only remember the position. Dependent objects are recalculated by timer and the undo
+                // command is pushed after release.
+                if (not m_previewing)
                 {
-                    const int xmargin = 50;
-                    const int ymargin = 50;
-
-                    const QRectF viewRect = VMainGraphicsView::SceneVisibleArea(view);
-                    const QRectF itemRect = mapToScene(boundingRect()).boundingRect();
-
-                    // If item's rect is bigger than view's rect ensureVisible works very unstable.
-                    if (itemRect.height() + 2*ymargin < viewRect.height() &&
-                        itemRect.width() + 2*xmargin < viewRect.width())
-                    {
-                         view->ensureVisible(itemRect, xmargin, ymargin);
-                    }
-                    else
+                    m_dragPos = newPos;
+                    if (not m_previewTimer->isActive())
                     {
-                        // Ensure visible only small rect around a cursor
-                        VMainGraphicsScene *currentScene = qobject_cast<VMainGraphicsScene *>(scene());
-                        SCASSERT(currentScene)
-                        const QPointF cursorPosition = currentScene->getScenePos();
-                        view->ensureVisible(QRectF(cursorPosition.x()-5, cursorPosition.y()-5, 10, 10));
+                        m_previewTimer->start();
                     }
+                    EnsurePointVisible();
                 }
             }
+            else
+            {
+                MoveSPoint *moveSP = new MoveSPoint(doc, newPos.x(), newPos.y(), m_id, this->scene());
+                connect(moveSP, &MoveSPoint::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
+                qApp->getUndoStack()->push(moveSP);
+                EnsurePointVisible();
+            }
             changeFinished = true;
         }
     }
@@ -356,6 +365,15 @@ void VToolBasePoint::mousePressEvent(QGraphicsSceneMouseEvent *event)
         if (event->button() == Qt::LeftButton && event->type() != QEvent::GraphicsSceneMouseDoubleClick)
         {
             SetItemOverrideCursor(this, cursorArrowCloseHand, 1, 1);
+
+            const QDomElement domElement = doc->elementById(m_id, VAbstractPattern::TagPoint);
+            if (domElement.isElement())
+            {
+                m_dragStartX = domElement.attribute(AttrX);
+                m_dragStartY = domElement.attribute(AttrY);
+                m_dragPos = pos();
+                m_dragging = true;
+            }
         }
     }
     VToolSinglePoint::mousePressEvent(event);
@@ -371,9 +389,30 @@ void VToolBasePoint::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
             SetItemOverrideCursor(this, cursorArrowOpenHand, 1, 1);
         }
     }
+    if (event->button() == Qt::LeftButton)
+    {
+        FinishMove();
+    }
     VToolSinglePoint::mouseReleaseEvent(event);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ungrabMouseEvent the point lost the mouse without release (dialog, another window). Dragging is cancelled.
+ */
+void VToolBasePoint::ungrabMouseEvent(QEvent *event)
+{
+    CancelMove();
+    VToolSinglePoint::ungrabMouseEvent(event);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VToolBasePoint::focusOutEvent(QFocusEvent *event)
+{
+    CancelMove();
+    VToolSinglePoint::focusOutEvent(event);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VToolBasePoint::SaveOptions(QDomElement &tag, QSharedPointer<VGObject> &obj)
 {
@@ -457,3 +496,122 @@ void VToolBasePoint::EnableToolMove(bool move)
     this->setFlag(QGraphicsItem::ItemIsMovable, move);
     VToolSinglePoint::EnableToolMove(move);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PreviewMove recalculate objects that depend on the point while it is being dragged.
+ *
+ * The file holds the dragged position only while dependent objects are recalculated, then gets the position before
+ * dragging back. Only objects that depend on the point are recalculated, the active draft block is reparsed only if
+ * the dependency graph can't handle the change.
+ */
+void VToolBasePoint::PreviewMove()
+{
+    if (not m_dragging)
+    {
+        return;
+    }
+
+    QDomElement domElement = doc->elementById(m_id, VAbstractPattern::TagPoint);
+    if (not domElement.isElement())
+    {
+        return;
+    }
+
+    m_previewing = true;
+    doc->SetAttribute(domElement, AttrX, QString().setNum(qApp->fromPixel(m_dragPos.x())));
+    doc->SetAttribute(domElement, AttrY, QString().setNum(qApp->fromPixel(m_dragPos.y())));
+    doc->LiteParseTree(Document::PreviewParse);
+    doc->SetAttribute(domElement, AttrX, m_dragStartX);
+    doc->SetAttribute(domElement, AttrY, m_dragStartY);
+    m_previewing = false;
+    m_previewed = true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FinishMove finish dragging with one undo command for the whole move.
+ */
+void VToolBasePoint::FinishMove()
+{
+    if (not m_dragging)
+    {
+        return;
+    }
+
+    m_dragging = false;
+    m_previewTimer->stop();
+
+    if (QString().setNum(qApp->fromPixel(m_dragPos.x())) == m_dragStartX
+            && QString().setNum(qApp->fromPixel(m_dragPos.y())) == m_dragStartY)
+    {
+        RestorePosition();
+        return;
+    }
+
+    // The file still has the position before dragging, undo command will return it.
+    m_previewed = false;
+    MoveSPoint *moveSP = new MoveSPoint(doc, m_dragPos.x(), m_dragPos.y(), m_id, this->scene());
+    connect(moveSP, &MoveSPoint::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
+    qApp->getUndoStack()->push(moveSP);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CancelMove stop dragging and return the point and its dependent objects to the position before dragging.
+ */
+void VToolBasePoint::CancelMove()
+{
+    if (not m_dragging)
+    {
+        return;
+    }
+
+    m_dragging = false;
+    m_previewTimer->stop();
+    RestorePosition();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VToolBasePoint::RestorePosition()
+{
+    if (m_previewed)
+    {
+        // Objects still have values of the last preview
+        m_previewed = false;
+        doc->LiteParseTree(Document::PreviewParse);
+    }
+    FullUpdateFromFile();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VToolBasePoint::EnsurePointVisible()
+{
+    const QList<QGraphicsView *> viewList = scene()->views();
+    if (not viewList.isEmpty())
+    {
+        if (QGraphicsView *view = viewList.at(0))
+        {
+            const int xmargin = 50;
+            const int ymargin = 50;
+
+            const QRectF viewRect = VMainGraphicsView::SceneVisibleArea(view);
+            const QRectF itemRect = mapToScene(boundingRect()).boundingRect();
+
+            // If item's rect is bigger than view's rect ensureVisible works very unstable.
+            if (itemRect.height() + 2*ymargin < viewRect.height() &&
+                itemRect.width() + 2*xmargin < viewRect.width())
+            {
+                 view->ensureVisible(itemRect, xmargin, ymargin);
+            }
+            else
+            {
+                // Ensure visible only small rect around a cursor
+                VMainGraphicsScene *currentScene = qobject_cast<VMainGraphicsScene *>(scene());
+                SCASSERT(currentScene)
+                const QPointF cursorPosition = currentScene->getScenePos();
+                view->ensureVisible(QRectF(cursorPosition.x()-5, cursorPosition.y()-5, 10, 10));
+            }
+        }
+    }
+}
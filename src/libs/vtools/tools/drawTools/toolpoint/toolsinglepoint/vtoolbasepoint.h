@@ -57,6 +57,7 @@
 #include <QGraphicsItem>
 #include <QMetaObject>
 #include <QObject>
+#include <QPointF>
 #include <QString>
 #include <QVariant>
 #include <Qt>
@@ -67,6 +68,7 @@
 #include "vtoolsinglepoint.h"
 
 template <class T> class QSharedPointer;
+class QTimer;
 
 /**
  * @brief The VToolBasePoint class tool for creation pattern base point. Only base point can move. All object
@@ -115,6 +117,8 @@ protected slots:
     virtual void           hoverLeaveEvent ( QGraphicsSceneHoverEvent * event ) Q_DECL_OVERRIDE;
     virtual void           mousePressEvent( QGraphicsSceneMouseEvent * event ) Q_DECL_OVERRIDE;
     virtual void           mouseReleaseEvent ( QGraphicsSceneMouseEvent * event ) Q_DECL_OVERRIDE;
+    virtual void           ungrabMouseEvent(QEvent *event) Q_DECL_OVERRIDE;
+    virtual void           focusOutEvent(QFocusEvent *event) Q_DECL_OVERRIDE;
     virtual void           SaveOptions(QDomElement &tag, QSharedPointer<VGObject> &obj) Q_DECL_OVERRIDE;
     virtual void           ReadToolAttributes(const QDomElement &domElement) Q_DECL_OVERRIDE;
     virtual void           SetVisualization() Q_DECL_OVERRIDE {}
@@ -125,9 +129,34 @@ protected slots:
 
     QString                draftBlockName;
 
+    /** @brief m_dragging true while the user drags the point with the mouse. */
+    bool                   m_dragging;
+
+    /** @brief m_dragStartX, m_dragStartY coordinates in the file when dragging started. */
+    QString                m_dragStartX;
+    QString                m_dragStartY;
+
+    /** @brief m_dragPos current position while dragging. The file keeps the position before dragging. */
+    QPointF                m_dragPos;
+
+    /** @brief m_previewTimer limits preview recalculation during dragging to the frame rate. */
+    QTimer                *m_previewTimer;
+
+    /** @brief m_previewing true while the preview recalculation updates the tool. */
+    bool                   m_previewing;
+
+    /** @brief m_previewed true if objects were recalculated for a position that is not in the file. */
+    bool                   m_previewed;
+
                            VToolBasePoint (VAbstractPattern *doc, VContainer *data, quint32 id,
                                            const Source &typeCreation, const QString &draftBlockName,
                                            QGraphicsItem * parent = nullptr );
+
+    void                   PreviewMove();
+    void                   FinishMove();
+    void                   CancelMove();
+    void                   RestorePosition();
+    void                   EnsurePointVisible();
 };
 
 #endif // VTOOLBASEPOINT_H
@@ -191,7 +191,7 @@ VToolPointOfIntersection *VToolPointOfIntersection::Create(const quint32 _id, co
                                                                        secondPointId, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(firstPoint->getIdTool());
         doc->IncrementReferens(secondPoint->getIdTool());
         return point;
@@ -159,7 +159,7 @@ VToolPointOfIntersectionArcs *VToolPointOfIntersectionArcs::Create(const quint32
                                                                                secondArcId, pType, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(firstArc->getIdTool());
         doc->IncrementReferens(secondArc->getIdTool());
         return point;
@@ -172,7 +172,7 @@ VToolPointOfIntersectionCurves *VToolPointOfIntersectionCurves::Create(const qui
                                                         hCrossPoint, typeCreation);
         scene->addItem(point);
         InitToolConnections(scene, point);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         doc->IncrementReferens(curve1->getIdTool());
         doc->IncrementReferens(curve2->getIdTool());
         return point;
@@ -190,11 +190,13 @@ QPointF VToolPointOfIntersectionCurves::FindPoint(const QVector<QPointF> &curve1
         return QPointF();
     }
 
+    const QVector<CurvesCrossing> crossings = VAbstractCurve::CurvesIntersect(curve1Points, curve2Points);
+
     QVector<QPointF> intersections;
-    for ( auto i = 0; i < curve1Points.count()-1; ++i )
+    intersections.reserve(crossings.size());
+    for (int i = 0; i < crossings.size(); ++i)
     {
-        intersections << VAbstractCurve::CurveIntersectLine(curve2Points,
-                                                            QLineF(curve1Points.at(i), curve1Points.at(i+1)));
+        intersections.append(crossings.at(i).point);
     }
 
     if (intersections.isEmpty())
@@ -176,12 +176,12 @@ VToolLine * VToolLine::Create(const quint32 &_id, const quint32 &firstPoint, con
     quint32 id = _id;
     if (typeCreation == Source::FromGui)
     {
-        id = VContainer::getNextId();
+        id = data->getNextId();
         data->AddLine(firstPoint, secondPoint);
     }
     else
     {
-        VContainer::UpdateId(id);
+        data->UpdateId(id);
         data->AddLine(firstPoint, secondPoint);
         if (parse != Document::FullParse)
         {
@@ -197,7 +197,7 @@ VToolLine * VToolLine::Create(const quint32 &_id, const quint32 &firstPoint, con
         InitDrawToolConnections(scene, line);
         connect(scene, &VMainGraphicsScene::EnableLineItemSelection, line, &VToolLine::AllowSelecting);
         connect(scene, &VMainGraphicsScene::EnableLineItemHover, line, &VToolLine::AllowHover);
-        VAbstractPattern::AddTool(id, line);
+        doc->AddTool(id, line);
 
         const QSharedPointer<VPointF> first = data->GeometricObject<VPointF>(firstPoint);
         const QSharedPointer<VPointF> second = data->GeometricObject<VPointF>(secondPoint);
@@ -101,11 +101,11 @@ void VNodeArc::Create(VAbstractPattern *doc, VContainer *data, quint32 id, quint
         VAbstractTool::AddRecord(id, Tool::NodeArc, doc);
         VNodeArc *arc = new VNodeArc(doc, data, id, idArc, typeCreation, drawName, idTool, doc);
 
-        VAbstractPattern::AddTool(id, arc);
+        doc->AddTool(id, arc);
         if (idTool != NULL_ID)
         {
             //Some nodes we don't show on scene. Tool that create this nodes must free memory.
-            VDataTool *tool = VAbstractPattern::getTool(idTool);
+            VDataTool *tool = doc->getTool(idTool);
             SCASSERT(tool != nullptr)
             arc->setParent(tool);// Adopted by a tool
         }
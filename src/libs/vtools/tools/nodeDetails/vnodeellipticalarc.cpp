@@ -74,11 +74,11 @@ void VNodeEllipticalArc::Create(VAbstractPattern *doc, VContainer *data, quint32
         VAbstractTool::AddRecord(id, Tool::NodeElArc, doc);
         VNodeEllipticalArc *arc = new VNodeEllipticalArc(doc, data, id, idArc, typeCreation, drawName, idTool, doc);
 
-        VAbstractPattern::AddTool(id, arc);
+        doc->AddTool(id, arc);
         if (idTool != NULL_ID)
         {
             //Some nodes we don't show on scene. Tool that create this nodes must free memory.
-            VDataTool *tool = VAbstractPattern::getTool(idTool);
+            VDataTool *tool = doc->getTool(idTool);
             SCASSERT(tool != nullptr)
             arc->setParent(tool);// Adopted by a tool
         }
@@ -147,11 +147,11 @@ void VNodePoint::Create(VAbstractPattern *doc, VContainer *data, VMainGraphicsSc
         connect(scene, &VMainGraphicsScene::EnablePointItemSelection, point, &VNodePoint::AllowSelecting);
         connect(scene, &VMainGraphicsScene::enableTextItemHover,      point, &VNodePoint::allowTextHover);
         connect(scene, &VMainGraphicsScene::enableTextItemSelection,  point, &VNodePoint::allowTextSelectable);
-        VAbstractPattern::AddTool(id, point);
+        doc->AddTool(id, point);
         if (idTool != NULL_ID)
         {
             //Some nodes we don't show on scene. Tool that create this node must free memory.
-            VDataTool *tool = VAbstractPattern::getTool(idTool);
+            VDataTool *tool = doc->getTool(idTool);
             SCASSERT(tool != nullptr)
             point->setParent(tool); // Adopted by a tool
         }
@@ -103,11 +103,11 @@ void VNodeSplinePath::Create(VAbstractPattern *doc, VContainer *data, quint32 id
         VAbstractTool::AddRecord(id, Tool::NodeSplinePath, doc);
         VNodeSplinePath *splPath = new VNodeSplinePath(doc, data, id, idSpline, typeCreation, drawName, idTool, doc);
 
-        VAbstractPattern::AddTool(id, splPath);
+        doc->AddTool(id, splPath);
         if (idTool != NULL_ID)
         {
             //Some nodes we don't show on scene. Tool that create this nodes must free memory.
-            VDataTool *tool = VAbstractPattern::getTool(idTool);
+            VDataTool *tool = doc->getTool(idTool);
             SCASSERT(tool != nullptr)
             splPath->setParent(tool);// Adopted by a tool
         }
@@ -99,11 +99,11 @@ VToolInternalPath *VToolInternalPath::Create(quint32 _id, const VPiecePath &path
         //Better check garbage before each saving file. Check only modeling tags.
         VToolInternalPath *pathTool = new VToolInternalPath(doc, data, id, pieceId, typeCreation, drawName, idTool, doc);
 
-        VAbstractPattern::AddTool(id, pathTool);
+        doc->AddTool(id, pathTool);
         if (idTool != NULL_ID)
         {
             //Some nodes we don't show on scene. Tool that create this nodes must free memory.
-            VDataTool *tool = VAbstractPattern::getTool(idTool);
+            VDataTool *tool = doc->getTool(idTool);
             SCASSERT(tool != nullptr);
             pathTool->setParent(tool);// Adopted by a tool
         }
@@ -112,7 +112,7 @@ VToolInternalPath *VToolInternalPath::Create(quint32 _id, const VPiecePath &path
             if (typeCreation == Source::FromGui && path.GetType() == PiecePathType::InternalPath)
             { // Seam allowance tool already initializated and can't init the path
                 SCASSERT(pieceId > NULL_ID);
-                VToolSeamAllowance *saTool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(pieceId));
+                VToolSeamAllowance *saTool = qobject_cast<VToolSeamAllowance*>(doc->getTool(pieceId));
                 SCASSERT(saTool != nullptr);
                 pathTool->setParentItem(saTool);
                 pathTool->SetParentType(ParentType::Item);
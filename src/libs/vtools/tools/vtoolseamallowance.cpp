@@ -167,7 +167,7 @@ VToolSeamAllowance *VToolSeamAllowance::Create(quint32 id, VPiece newPiece, QStr
         connect(scene, &VMainGraphicsScene::EnableDetailItemHover,     patternPiece, &VToolSeamAllowance::AllowHover);
         connect(scene, &VMainGraphicsScene::EnableDetailItemSelection, patternPiece, &VToolSeamAllowance::AllowSelecting);
         connect(scene, &VMainGraphicsScene::HighlightDetail,           patternPiece, &VToolSeamAllowance::Highlight);
-        VAbstractPattern::AddTool(id, patternPiece);
+        doc->AddTool(id, patternPiece);
     }
     //Very important to delete it. Only this tool need this special variable.
     data->RemoveVariable(currentSeamAllowance);
@@ -220,7 +220,7 @@ void VToolSeamAllowance::InsertNode(VPieceNode node, quint32 pieceId, VMainGraph
         newPiece.GetPath().Append(node);
 
         // Seam allowance tool already initializated and can't init the node
-        VToolSeamAllowance *patternPiece = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(pieceId));
+        VToolSeamAllowance *patternPiece = qobject_cast<VToolSeamAllowance*>(doc->getTool(pieceId));
         SCASSERT(patternPiece != nullptr);
 
         InitNode(node, scene, data, doc, patternPiece);
@@ -1360,7 +1360,7 @@ void VToolSeamAllowance::UpdateExcludeState()
         const VPieceNode &node = piece.GetPath().at(i);
         if (node.GetTypeTool() == Tool::NodePoint)
         {
-            VNodePoint *tool = qobject_cast<VNodePoint*>(VAbstractPattern::getTool(node.GetId()));
+            VNodePoint *tool = qobject_cast<VNodePoint*>(doc->getTool(node.GetId()));
             SCASSERT(tool != nullptr);
 
             tool->SetExluded(node.isExcluded());
@@ -1650,7 +1650,7 @@ void VToolSeamAllowance::InitNode(const VPieceNode &node, VMainGraphicsScene *sc
     {
         case (Tool::NodePoint):
         {
-            VNodePoint *tool = qobject_cast<VNodePoint*>(VAbstractPattern::getTool(node.GetId()));
+            VNodePoint *tool = qobject_cast<VNodePoint*>(doc->getTool(node.GetId()));
             SCASSERT(tool != nullptr);
 
             connect(tool, &VNodePoint::chosenTool, scene, &VMainGraphicsScene::chosenItem, Qt::UniqueConnection);
@@ -1701,7 +1701,7 @@ void VToolSeamAllowance::InitInternalPaths(const VPiece &piece)
         Qt::PenStyle lineType   = path.GetPenType();
         qreal   lineWeight = ToPixel(qApp->Settings()->getDefaultInternalLineweight(), Unit::Mm);
 
-        auto *tool = qobject_cast<VToolInternalPath*>(VAbstractPattern::getTool(pathIds.at(i)));
+        auto *tool = qobject_cast<VToolInternalPath*>(doc->getTool(pathIds.at(i)));
         SCASSERT(tool != nullptr);
         tool->setParentItem(this);
         tool->SetParentType(ParentType::Item);
@@ -1319,7 +1319,7 @@ void CreateUnitedDetail(quint32 id, const VToolUnionDetailsInitData &initData, q
 
     auto RemoveDetail = [initData](quint32 id)
     {
-        VToolSeamAllowance *toolDet = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(id));
+        VToolSeamAllowance *toolDet = qobject_cast<VToolSeamAllowance*>(initData.doc->getTool(id));
         SCASSERT(toolDet != nullptr);
         bool ask = false;
         toolDet->Remove(ask);
@@ -1492,7 +1492,7 @@ VToolUnionDetails* VToolUnionDetails::Create(const quint32 _id, const VToolUnion
     quint32 id = _id;
     if (initData.typeCreation == Source::FromGui)
     {
-        id = VContainer::getNextId();
+        id = initData.data->getNextId();
     }
     else
     {
@@ -1508,7 +1508,7 @@ VToolUnionDetails* VToolUnionDetails::Create(const quint32 _id, const VToolUnion
         VAbstractTool::AddRecord(id, Tool::UnionDetails, initData.doc);
         //Scene doesn't show this tool, so doc will destroy this object.
         unionDetails = new VToolUnionDetails(id, initData);
-        VAbstractPattern::AddTool(id, unionDetails);
+        initData.doc->AddTool(id, unionDetails);
         // Unfortunatelly doc will destroy all objects only in the end, but we should delete them before each FullParse
         initData.doc->AddToolOnRemove(unionDetails);
     }
@@ -1569,6 +1569,7 @@ void VToolUnionDetails::AddToModeling(const QDomElement &domElement)
     if (not modeling.isNull())
     {
         modeling.appendChild(domElement);
+        doc->CacheElementIds(domElement);
     }
     else
     {
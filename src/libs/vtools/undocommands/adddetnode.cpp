@@ -86,6 +86,7 @@ void AddDetNode::undo()
                 qCDebug(vUndo, "Can't delete node.");
                 return;
             }
+            doc->UncacheElementIds(domElement);
         }
         else
         {
@@ -109,6 +110,7 @@ void AddDetNode::redo()
     if (not modeling.isNull())
     {
         modeling.appendChild(xml);
+        doc->CacheElementIds(xml);
     }
     else
     {
@@ -84,6 +84,7 @@ void AddPatternPiece::undo()
         QDomElement rootElement = doc->documentElement();
         QDomElement patternPiece = doc->GetPPElement(draftBlockName);
         rootElement.removeChild(patternPiece);
+        doc->UncacheElementIds(patternPiece);
         emit NeedFullParsing();
     }
 }
@@ -101,6 +102,7 @@ void AddPatternPiece::redo()
     QDomElement rootElement = doc->documentElement();
 
     rootElement.appendChild(xml);
+    doc->CacheElementIds(xml);
 
     RedoFullParsing();
 }
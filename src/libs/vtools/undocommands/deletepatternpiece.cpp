@@ -105,6 +105,7 @@ void DeletePatternPiece::undo()
         Q_ASSERT_X(not draw.isNull(), Q_FUNC_INFO, "Couldn't' find tag draw");
         rootElement.insertBefore(patternPiece, draw);
     }
+    doc->CacheElementIds(patternPiece);
 
     emit NeedFullParsing();
     doc->changeActiveDraftBlock(draftBlockName);
@@ -118,5 +119,6 @@ void DeletePatternPiece::redo()
     QDomElement rootElement = doc->documentElement();
     const QDomElement patternPiece = doc->GetPPElement(draftBlockName);
     rootElement.removeChild(patternPiece);
+    doc->UncacheElementIds(patternPiece);
     emit NeedFullParsing();
 }
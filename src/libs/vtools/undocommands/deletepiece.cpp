@@ -118,10 +118,11 @@ void DeletePiece::redo()
     if (domElement.isElement())
     {
         m_parentNode.removeChild(domElement);
+        doc->UncacheElementIds(domElement);
 
         // UnionDetails delete two old details and create one new.
         // So when UnionDetail delete detail we can't use FullParsing. So we hide detail on scene directly.
-        VToolSeamAllowance *toolDet = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(nodeId));
+        VToolSeamAllowance *toolDet = qobject_cast<VToolSeamAllowance*>(doc->getTool(nodeId));
         SCASSERT(toolDet != nullptr);
         toolDet->hide();
 
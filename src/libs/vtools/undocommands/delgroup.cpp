@@ -87,6 +87,7 @@ void DelGroup::undo()
     if (not groups.isNull())
     {
         groups.appendChild(xml);
+        doc->CacheElementIds(xml);
         doc->ParseGroups(groups);
         emit UpdateGroups();
     }
@@ -119,6 +120,7 @@ void DelGroup::redo()
                 qCDebug(vUndo, "Can't delete group.");
                 return;
             }
+            doc->UncacheElementIds(group);
             emit UpdateGroups();
 
             if (groups.childNodes().isEmpty())
@@ -169,7 +169,7 @@ void MoveDoubleLabel::Do(const QPointF &pos)
             doc->SetAttribute(domElement, AttrMy2, QString().setNum(qApp->fromPixel(pos.y())));
         }
 
-        if (VDrawTool *tool = qobject_cast<VDrawTool *>(VAbstractPattern::getTool(m_idTool)))
+        if (VDrawTool *tool = qobject_cast<VDrawTool *>(doc->getTool(m_idTool)))
         {
             tool->setPointNamePosition(nodeId, pos);
         }
@@ -113,7 +113,7 @@ void MoveLabel::Do(const QPointF &pos)
         doc->SetAttribute(domElement, AttrMx, QString().setNum(qApp->fromPixel(pos.x())));
         doc->SetAttribute(domElement, AttrMy, QString().setNum(qApp->fromPixel(pos.y())));
 
-        if (VAbstractTool *tool = qobject_cast<VAbstractTool *>(VAbstractPattern::getTool(nodeId)))
+        if (VAbstractTool *tool = qobject_cast<VAbstractTool *>(doc->getTool(nodeId)))
         {
             tool->setPointNamePosition(nodeId, pos);
         }
@@ -126,7 +126,7 @@ void MoveOperationLabel::Do(const QPointF &pos)
         doc->SetAttribute(domElement, AttrMx, QString().setNum(qApp->fromPixel(pos.x())));
         doc->SetAttribute(domElement, AttrMy, QString().setNum(qApp->fromPixel(pos.y())));
 
-        if (VDrawTool *tool = qobject_cast<VDrawTool *>(VAbstractPattern::getTool(m_idTool)))
+        if (VDrawTool *tool = qobject_cast<VDrawTool *>(doc->getTool(m_idTool)))
         {
             tool->setPointNamePosition(nodeId, pos);
         }
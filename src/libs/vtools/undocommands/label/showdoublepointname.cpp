@@ -102,7 +102,7 @@ void ShowDoublePointName::setVisibility(bool visible)
             doc->SetAttribute<bool>(domElement, AttrShowPointName2, visible);
         }
 
-        if (VDrawTool *tool = qobject_cast<VDrawTool *>(VAbstractPattern::getTool(m_idTool)))
+        if (VDrawTool *tool = qobject_cast<VDrawTool *>(doc->getTool(m_idTool)))
         {
             tool->setPointNameVisiblity(nodeId, visible);
         }
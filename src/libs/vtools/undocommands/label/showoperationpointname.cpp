@@ -79,7 +79,7 @@
      {
          doc->SetAttribute<bool>(domElement, AttrShowPointName, visible);
 
-         if (VDrawTool *tool = qobject_cast<VDrawTool *>(VAbstractPattern::getTool(m_idTool)))
+         if (VDrawTool *tool = qobject_cast<VDrawTool *>(doc->getTool(m_idTool)))
          {
              tool->setPointNameVisiblity(nodeId, visible);
          }
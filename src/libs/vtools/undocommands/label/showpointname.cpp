@@ -78,7 +78,7 @@ void ShowPointName::setVisibility(bool visible)
     {
         doc->SetAttribute<bool>(domElement, AttrShowPointName, visible);
 
-        if (VAbstractTool *tool = qobject_cast<VAbstractTool *>(VAbstractPattern::getTool(nodeId)))
+        if (VAbstractTool *tool = qobject_cast<VAbstractTool *>(doc->getTool(nodeId)))
         {
             tool->setPointNameVisiblity(nodeId, visible);
         }
@@ -103,7 +103,7 @@ void MovePiece::undo()
     {
         SaveCoordinates(domElement, m_oldX, m_oldY);
 
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
@@ -123,7 +123,7 @@ void MovePiece::redo()
 
         if (redoFlag)
         {
-            emit NeedLiteParsing(Document::LiteParse);
+            emit NeedLiteParsing(Document::IncrementalParse);
         }
         else
         {
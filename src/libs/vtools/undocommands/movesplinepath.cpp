@@ -128,7 +128,7 @@ void MoveSplinePath::Do(const VSplinePath &splPath)
     {
         VToolSplinePath::UpdatePathPoints(doc, domElement, splPath);
 
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
@@ -104,7 +104,7 @@ void SavePieceOptions::undo()
         IncrementReferences(m_oldDet.MissingCSAPath(m_newDet));
         IncrementReferences(m_oldDet.MissingInternalPaths(m_newDet));
         IncrementReferences(m_oldDet.MissingPins(m_newDet));
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
@@ -136,7 +136,7 @@ void SavePieceOptions::redo()
         DecrementReferences(m_oldDet.MissingInternalPaths(m_newDet));
         DecrementReferences(m_oldDet.MissingPins(m_newDet));
 
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
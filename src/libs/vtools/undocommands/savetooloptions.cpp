@@ -80,8 +80,10 @@ void SaveToolOptions::undo()
     if (domElement.isElement())
     {
         domElement.parentNode().replaceChild(oldXml, domElement);
+        doc->UncacheElementIds(domElement);
+        doc->CacheElementIds(oldXml);
 
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
@@ -99,8 +101,10 @@ void SaveToolOptions::redo()
     if (domElement.isElement())
     {
         domElement.parentNode().replaceChild(newXml, domElement);
+        doc->UncacheElementIds(domElement);
+        doc->CacheElementIds(newXml);
 
-        emit NeedLiteParsing(Document::LiteParse);
+        emit NeedLiteParsing(Document::IncrementalParse);
     }
     else
     {
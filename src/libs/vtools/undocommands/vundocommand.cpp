@@ -100,6 +100,7 @@ void VUndoCommand::UndoDeleteAfterSibling(QDomNode &parentNode, const quint32 &s
         const QDomElement refElement = doc->NodeById(siblingId);
         parentNode.insertAfter(xml, refElement);
     }
+    doc->CacheElementIds(xml);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,247 @@
+/**************************************************************************
+ **
+ **  @file   tst_layoutbenchmark.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_layoutbenchmark.h"
+
+#include <QElapsedTimer>
+#include <QMarginsF>
+#include <QPointF>
+#include <QtMath>
+#include <QtTest>
+
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+
+namespace
+{
+const qreal pxPerCm = 37.795275590551178; // 96 dpi
+const qreal paperWidth = 150 * pxPerCm;
+const qreal paperHeight = 300 * pxPerCm;
+const qreal layoutWidth = 0.3 * pxPerCm;
+
+//---------------------------------------------------------------------------------------------------------------------
+// Small linear congruential generator. Unlike qrand() gives the same sequence on all platforms.
+class Random
+{
+public:
+    explicit Random(quint32 seed)
+        : state(seed)
+    {}
+
+    qreal Next(qreal min, qreal max)
+    {
+        state = state * 1664525u + 1013904223u;
+        return min + (max - min) * (state >> 8) / static_cast<qreal>(1u << 24);
+    }
+
+private:
+    quint32 state;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// All shapes go clockwise on screen, as main paths of pieces do. Otherwise layout allowance goes inside.
+QVector<QPointF> Rectangle(qreal width, qreal height)
+{
+    return QVector<QPointF>() << QPointF(0, 0) << QPointF(width, 0) << QPointF(width, height) << QPointF(0, height);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Trapezoid(qreal bottom, qreal top, qreal height)
+{
+    const qreal shift = (bottom - top) / 2;
+    return QVector<QPointF>() << QPointF(0, height) << QPointF(shift, 0) << QPointF(shift + top, 0)
+                              << QPointF(bottom, height);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> LShape(qreal width, qreal height, qreal thickness)
+{
+    return QVector<QPointF>() << QPointF(0, 0) << QPointF(thickness, 0) << QPointF(thickness, height - thickness)
+                              << QPointF(width, height - thickness) << QPointF(width, height) << QPointF(0, height);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Sleeve like piece: straight sides and bottom, sleeve cap approximated by a half ellipse.
+QVector<QPointF> Sleeve(qreal width, qreal height, qreal capHeight)
+{
+    QVector<QPointF> points;
+    points << QPointF(width * 0.85, height) << QPointF(width * 0.15, height);
+
+    const int capPoints = 32;
+    for (int i = 0; i <= capPoints; ++i)
+    {
+        const qreal angle = M_PI - M_PI * i / capPoints;
+        points << QPointF(width / 2 + width / 2 * qCos(angle), capHeight - capHeight * qSin(angle));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Ellipse(qreal width, qreal height)
+{
+    QVector<QPointF> points;
+    const int count = 48;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / count;
+        points << QPointF(width / 2 + width / 2 * qCos(angle), height / 2 + height / 2 * qSin(angle));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal Area(const QVector<QPointF> &points)
+{
+    qreal area = 0;
+    for (int i = 0; i < points.size(); ++i)
+    {
+        const QPointF &p1 = points.at(i);
+        const QPointF &p2 = points.at((i + 1) % points.size());
+        area += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    return qAbs(area) / 2;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_LayoutBenchmark::TST_LayoutBenchmark(QObject *parent)
+    : QObject(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_LayoutBenchmark::Generate_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10") << 10;
+    QTest::newRow("50") << 50;
+    QTest::newRow("200") << 200;
+    QTest::newRow("500") << 500;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_LayoutBenchmark::Generate() const
+{
+    QFETCH(int, count);
+
+    VLayoutGenerator generator;
+    generator.SetDetails(PieceSet(count));
+    generator.SetLayoutWidth(layoutWidth);
+    generator.SetCaseType(Cases::CaseDesc);
+    generator.SetPaperWidth(paperWidth);
+    generator.SetPaperHeight(paperHeight);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetShift(0);
+    generator.SetRotate(true);
+    generator.SetRotationIncrease(180);
+    generator.SetAutoCrop(false);
+    generator.SetSaveLength(false);
+    generator.SetUnitePages(false);
+
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK_ONCE
+    {
+        generator.Generate();
+    }
+    const qint64 elapsed = timer.elapsed();
+
+    QVERIFY(generator.State() == LayoutErrors::NoError);
+
+    const QVector<QVector<VLayoutPiece>> sheets = generator.GetAllDetails();
+    qreal piecesArea = 0;
+    qreal usedArea = 0;
+    for (int i = 0; i < sheets.size(); ++i)
+    {
+        qreal length = 0;
+        for (int j = 0; j < sheets.at(i).size(); ++j)
+        {
+            const VLayoutPiece &piece = sheets.at(i).at(j);
+            piecesArea += Area(piece.getContourPoints());
+            length = qMax(length, piece.DetailBoundingRect().bottom());
+        }
+        usedArea += paperWidth * length;
+    }
+
+    const qreal efficiency = qFuzzyIsNull(usedArea) ? 0 : piecesArea / usedArea * 100;
+    qDebug("%d pieces: %lld ms, %d placements, %lld collision tests, %d sheets, efficiency %.1f%%", count, elapsed,
+           generator.PlacementCount(), generator.CrossingCount(), sheets.size(), efficiency);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PieceSet return count pieces of mixed shapes. Same count always gives the same set.
+ */
+QVector<VLayoutPiece> TST_LayoutBenchmark::PieceSet(int count)
+{
+    Random random(20150131u);
+    QVector<VLayoutPiece> pieces;
+    pieces.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        QVector<QPointF> points;
+        switch (i % 5)
+        {
+            case 0:
+                points = Rectangle(random.Next(10, 40) * pxPerCm, random.Next(10, 60) * pxPerCm);
+                break;
+            case 1:
+            {
+                const qreal bottom = random.Next(20, 50) * pxPerCm;
+                points = Trapezoid(bottom, bottom * random.Next(0.3, 0.9), random.Next(20, 70) * pxPerCm);
+                break;
+            }
+            case 2:
+            {
+                const qreal width = random.Next(15, 40) * pxPerCm;
+                points = LShape(width, random.Next(20, 50) * pxPerCm, width * random.Next(0.3, 0.6));
+                break;
+            }
+            case 3:
+            {
+                const qreal height = random.Next(40, 65) * pxPerCm;
+                points = Sleeve(random.Next(30, 45) * pxPerCm, height, height * random.Next(0.2, 0.35));
+                break;
+            }
+            default:
+                points = Ellipse(random.Next(8, 30) * pxPerCm, random.Next(8, 30) * pxPerCm);
+                break;
+        }
+
+        VLayoutPiece piece;
+        piece.SetName(QString("Piece %1").arg(i + 1));
+        piece.SetCountourPoints(points);
+        pieces.append(piece);
+    }
+    return pieces;
+}
+
+QTEST_MAIN(TST_LayoutBenchmark)
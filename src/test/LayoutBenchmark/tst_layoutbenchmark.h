@@ -0,0 +1,58 @@
+/**************************************************************************
+ **
+ **  @file   tst_layoutbenchmark.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TST_LAYOUTBENCHMARK_H
+#define TST_LAYOUTBENCHMARK_H
+
+#include <QObject>
+#include <QVector>
+
+class VLayoutPiece;
+
+/**
+ * @brief The TST_LayoutBenchmark class measures layout generation on reproducible piece sets.
+ *
+ * Piece sets are generated from a fixed seed, so every run and every platform gets the same shapes. Besides wall time
+ * each row reports placements, polygon collision tests, used sheets and efficiency (area of pieces to used area of
+ * sheets).
+ */
+class TST_LayoutBenchmark : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TST_LayoutBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void Generate_data() const;
+    void Generate() const;
+
+private:
+    static QVector<VLayoutPiece> PieceSet(int count);
+};
+
+#endif // TST_LAYOUTBENCHMARK_H
@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT       += core testlib gui printsupport xml xmlpatterns
+QT       += core testlib gui widgets printsupport xml xmlpatterns
 
 TARGET = Seamly2DTests
 
@@ -62,7 +62,12 @@ SOURCES += \
     tst_vpointf.cpp \
     tst_readval.cpp \
     tst_vtranslatevars.cpp \
-    tst_vabstractpiece.cpp
+    tst_vabstractpiece.cpp \
+    tst_vpolygoncollision.cpp \
+    tst_vdependencygraph.cpp \
+    tst_calculator.cpp \
+    tst_vpattern.cpp \
+    tst_vcontainer.cpp
 
 *msvc*:SOURCES += stable.cpp
 
@@ -88,7 +93,15 @@ HEADERS += \
     tst_vpointf.h \
     tst_readval.h \
     tst_vtranslatevars.h \
-    tst_vabstractpiece.h
+    tst_vabstractpiece.h \
+    tst_vpolygoncollision.h \
+    tst_vdependencygraph.h \
+    tst_calculator.h \
+    tst_vpattern.h \
+    tst_vcontainer.h
+
+# Pattern document of the application, tested without the main window
+include(../../app/seamly2d/xml/xml.pri)
 
 # Set using ccache. Function enable_ccache() defined in common.pri.
 $$enable_ccache()
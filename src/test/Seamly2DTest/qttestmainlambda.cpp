@@ -72,6 +72,11 @@
 #include "tst_vpointf.h"
 #include "tst_readval.h"
 #include "tst_vtranslatevars.h"
+#include "tst_vpolygoncollision.h"
+#include "tst_vdependencygraph.h"
+#include "tst_calculator.h"
+#include "tst_vpattern.h"
+#include "tst_vcontainer.h"
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmudef.h"
@@ -159,6 +164,11 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_VPointF());
     ASSERT_TEST(new TST_ReadVal());
     ASSERT_TEST(new TST_VTranslateVars());
+    ASSERT_TEST(new TST_VPolygonCollision());
+    ASSERT_TEST(new TST_VDependencyGraph());
+    ASSERT_TEST(new TST_Calculator());
+    ASSERT_TEST(new TST_VPattern());
+    ASSERT_TEST(new TST_VContainer());
 
     return status;
 }
@@ -0,0 +1,107 @@
+/**************************************************************************
+ **
+ **  @file   tst_calculator.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_calculator.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vpatterndb/variables/vlinelength.h"
+#include "../vpatterndb/variables/vmeasurement.h"
+#include "../vgeometry/vpointf.h"
+#include "../qmuparser/qmuparsererror.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_Calculator::TST_Calculator(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::BulkEval_data() const
+{
+    QTest::addColumn<QString>("formula");
+    QTest::addColumn<QVector<qreal>>("expect");
+
+    QTest::newRow("Measurement") << QStringLiteral("chest*2+1") << (QVector<qreal>() << 193 << 213 << 197);
+    QTest::newRow("Constant") << QStringLiteral("5") << (QVector<qreal>() << 5 << 5 << 5);
+    QTest::newRow("Increment") << QStringLiteral("#half+1") << (QVector<qreal>() << 49 << 54 << 50);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Each result must match the value the measurement has for the same size and height. Increment is evaluated for each
+// size and height too, its own value is valid only for the current ones.
+void TST_Calculator::BulkEval() const
+{
+    QFETCH(QString, formula);
+    QFETCH(QVector<qreal>, expect);
+
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    VMeasurement *m = new VMeasurement(0, QStringLiteral("chest"), 50, 176, 100, 4, 2);
+    m->SetUnit(&unit);
+    data.AddVariable(m->GetName(), m);
+
+    const QString half = QStringLiteral("#half");
+    data.AddVariable(half, new VIncrement(&data, half, 0, 50, QStringLiteral("chest/2"), true));
+
+    const QVector<qreal> sizes = QVector<qreal>() << 48 << 52 << 50;
+    const QVector<qreal> heights = QVector<qreal>() << 176 << 182 << 170;
+
+    const QVector<qreal> result = Calculator().EvalFormula(data.DataVariables(), formula, sizes, heights);
+    QCOMPARE(result, expect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Length of a line is known only for the current size and height.
+void TST_Calculator::BulkEvalGeometry() const
+{
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    const VPointF p1(0, 0, QStringLiteral("A"), 0, 0);
+    const VPointF p2(10, 0, QStringLiteral("B"), 0, 0);
+    VLengthLine *length = new VLengthLine(&p1, 1, &p2, 2, unit);
+    data.AddVariable(length->GetName(), length);
+
+    const QVector<qreal> sizes = QVector<qreal>() << 48 << 52;
+    const QVector<qreal> heights = QVector<qreal>() << 176 << 182;
+
+    try
+    {
+        Calculator().EvalFormula(data.DataVariables(), length->GetName() + QStringLiteral("*2"), sizes, heights);
+    }
+    catch (const qmu::QmuParserError &e)
+    {
+        QCOMPARE(e.GetToken(), length->GetName());
+        return;
+    }
+    QFAIL("Formula with length of line must not be evaluated in bulk.");
+}
@@ -0,0 +1,46 @@
+/**************************************************************************
+ **
+ **  @file   tst_calculator.h
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TST_CALCULATOR_H
+#define TST_CALCULATOR_H
+
+#include <QObject>
+
+class TST_Calculator : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TST_Calculator(QObject *parent = nullptr);
+
+private slots:
+    void BulkEval_data() const;
+    void BulkEval() const;
+    void BulkEvalGeometry() const;
+};
+
+#endif // TST_CALCULATOR_H
@@ -51,6 +51,7 @@
 
 #include "tst_vabstractcurve.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vspline.h"
 
 #include <QtTest>
 
@@ -191,3 +192,66 @@ void TST_VAbstractCurve::IsPointOnCurve() const
     bool result = VAbstractCurve::IsPointOnCurve(points, point);
     QCOMPARE(result, expectedResult);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractCurve::CurvesIntersect() const
+{
+    // Zigzag crossing a horizontal line at every segment
+    QVector<QPointF> zigzag;
+    for (int i = 0; i <= 20; ++i)
+    {
+        zigzag << QPointF(i * 10, (i % 2) ? 10 : -10);
+    }
+
+    QVector<QPointF> line;
+    line << QPointF(-5, 0) << QPointF(100, 0) << QPointF(205, 0);
+
+    const QVector<CurvesCrossing> crossings = VAbstractCurve::CurvesIntersect(zigzag, line);
+    QCOMPARE(crossings.size(), 20);
+
+    for (int i = 0; i < crossings.size(); ++i)
+    {
+        const CurvesCrossing &crossing = crossings.at(i);
+        QCOMPARE(crossing.point, QPointF(i * 10 + 5, 0));
+        QCOMPARE(crossing.t1, i + 0.5);
+
+        const qreal x = crossing.point.x();
+        QCOMPARE(crossing.t2, x < 100 ? (x + 5) / 105 : 1 + (x - 100) / 105);
+    }
+
+    QVERIFY(VAbstractCurve::CurvesIntersect(zigzag, QVector<QPointF>() << QPointF(0, 20) << QPointF(200, 20))
+            .isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractCurve::IntersectLine() const
+{
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+
+    const VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+    const QVector<QPointF> points = spl.GetPoints();
+
+    for (int i = 0; i < 36; ++i)
+    {
+        const QLineF axis = VGObject::BuildAxis(QPointF(950, 900), i * 10, QRectF(0, 0, 2000, 2000));
+
+        // Same points in the same order as scanning all segments
+        const QVector<QPointF> expected = VAbstractCurve::CurveIntersectLine(points, axis);
+        QCOMPARE(spl.IntersectLine(axis), expected);
+        QCOMPARE(spl.IsIntersectLine(axis), not expected.isEmpty());
+    }
+
+    QVERIFY(not spl.IsIntersectLine(QLineF(0, 0, 100, 100)));
+
+    // Nearly parallel segments cross as long as QLineF::intersects() says so
+    const QLineF line(0, 0, 1, 0);
+    const QLineF segment(0.5, -1e-13, 0.6, 1e-13);
+    QCOMPARE(line.intersects(segment, nullptr), QLineF::BoundedIntersection);
+
+    const QVector<CurvesCrossing> crossings = VAbstractCurve::CurvesIntersect(QVector<QPointF>() << line.p1()
+                                                                                                 << line.p2(),
+                                                                              QVector<QPointF>() << segment.p1()
+                                                                                                 << segment.p2());
+    QCOMPARE(crossings.size(), 1);
+}
@@ -63,6 +63,8 @@ class TST_VAbstractCurve : public AbstractTest
 private slots:
     void IsPointOnCurve_data() const;
     void IsPointOnCurve() const;
+    void CurvesIntersect() const;
+    void IntersectLine() const;
 };
 
 #endif // TST_VABSTRACTCURVE_H
@@ -0,0 +1,129 @@
+/**************************************************************************
+ **
+ **  @file   tst_vcontainer.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vcontainer.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vgeometry/vpointf.h"
+#include "../vgeometry/vspline.h"
+
+#include <QThread>
+#include <QtTest>
+
+namespace
+{
+const quint32 objectsCount = 2000;
+
+/**
+ * @brief The PatternThread class evaluates own pattern and reads a curve shared with other threads.
+ */
+class PatternThread : public QThread
+{
+public:
+    PatternThread(qreal size, const VSpline &spline)
+        : QThread(),
+          m_size(size),
+          m_spline(spline),
+          m_lastId(NULL_ID),
+          m_readSize(0),
+          m_uniqueNames(0),
+          m_length(0)
+    {}
+
+    quint32 LastId() const {return m_lastId;}
+    qreal   ReadSize() const {return m_readSize;}
+    int     UniqueNames() const {return m_uniqueNames;}
+    qreal   Length() const {return m_length;}
+
+protected:
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        Unit unit = Unit::Cm;
+        VContainer data(nullptr, &unit);
+        data.SetSize(m_size);
+
+        // Tool data is a copy that keeps the state of its pattern
+        VContainer toolData(data);
+        for (quint32 i = 0; i < objectsCount; ++i)
+        {
+            data.AddGObject(new VPointF(i, i, QStringLiteral("A%1").arg(i), 0, 0));
+            toolData.getNextId();
+        }
+
+        m_lastId = data.getId();
+        m_readSize = toolData.size();
+        m_uniqueNames = toolData.AllUniqueNames().size();
+        m_length = m_spline.GetLength();
+    }
+
+private:
+    Q_DISABLE_COPY(PatternThread)
+    qreal   m_size;
+    VSpline m_spline;
+    quint32 m_lastId;
+    qreal   m_readSize;
+    int     m_uniqueNames;
+    qreal   m_length;
+};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VContainer::TST_VContainer(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TwoPatternsOnTwoThreads check that patterns evaluated at the same time don't share ids, size and names, and
+ * that copies of a curve may be measured on different threads.
+ */
+void TST_VContainer::TwoPatternsOnTwoThreads() const
+{
+    const VPointF p1(0, 0, QStringLiteral("p1"), 0, 0);
+    const VPointF p4(100, 0, QStringLiteral("p4"), 0, 0);
+    const VSpline spline(p1, QPointF(20, 80), QPointF(80, 80), p4);
+
+    // Both threads get copies of the same curve, its cache is not filled yet
+    PatternThread first(48, spline);
+    PatternThread second(52, spline);
+    first.start();
+    second.start();
+    QVERIFY(first.wait());
+    QVERIFY(second.wait());
+
+    QCOMPARE(first.LastId(), objectsCount * 2);
+    QCOMPARE(second.LastId(), objectsCount * 2);
+    QCOMPARE(first.ReadSize(), 48.0);
+    QCOMPARE(second.ReadSize(), 52.0);
+    QCOMPARE(first.UniqueNames(), static_cast<int>(objectsCount));
+    QCOMPARE(second.UniqueNames(), static_cast<int>(objectsCount));
+
+    const qreal length = VSpline(p1, QPointF(20, 80), QPointF(80, 80), p4).GetLength();
+    QCOMPARE(first.Length(), length);
+    QCOMPARE(second.Length(), length);
+}
@@ -0,0 +1,99 @@
+/**************************************************************************
+ **
+ **  @file   tst_vdependencygraph.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vdependencygraph.h"
+#include "../ifc/xml/vdependencygraph.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// A(1) <- B(2) <- C(4), D(3) is independent, E(5) uses B and D, F(6) lives in other block and uses C.
+VDependencyGraph MakeGraph()
+{
+    VDependencyGraph graph;
+    graph.AddNode(1, QStringLiteral("Block 1"), 1, QStringLiteral("A"));
+    graph.AddNode(2, QStringLiteral("Block 1"), 2, QStringLiteral("B"));
+    graph.AddNode(3, QStringLiteral("Block 1"), 3, QStringLiteral("D"));
+    graph.AddNode(4, QStringLiteral("Block 1"), 4, QStringLiteral("C"));
+    graph.AddNode(5, QStringLiteral("Block 1"), 5, QStringLiteral("E"));
+    graph.AddNode(6, QStringLiteral("Block 2"), 6, QStringLiteral("F"));
+
+    graph.AddDependency(2, 1);
+    graph.AddDependency(4, 2);
+    graph.AddDependency(5, 2);
+    graph.AddDependency(5, 3);
+    graph.AddDependency(6, 4);
+    return graph;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDependencyGraph::TST_VDependencyGraph(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::Dependents_data() const
+{
+    QTest::addColumn<QVector<quint32>>("changed");
+    QTest::addColumn<QVector<quint32>>("expect");
+
+    QTest::newRow("Root") << (QVector<quint32>() << 1) << (QVector<quint32>() << 1 << 2 << 4 << 5 << 6);
+    QTest::newRow("Independent") << (QVector<quint32>() << 3) << (QVector<quint32>() << 3 << 5);
+    QTest::newRow("Leaf") << (QVector<quint32>() << 6) << (QVector<quint32>() << 6);
+    QTest::newRow("Keeps order") << (QVector<quint32>() << 4 << 3) << (QVector<quint32>() << 3 << 4 << 5 << 6);
+    QTest::newRow("Unknown id") << (QVector<quint32>() << 100) << QVector<quint32>();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::Dependents() const
+{
+    QFETCH(QVector<quint32>, changed);
+    QFETCH(QVector<quint32>, expect);
+
+    QCOMPARE(MakeGraph().Dependents(changed), expect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::ReplaceNode() const
+{
+    VDependencyGraph graph = MakeGraph();
+
+    // E doesn't use B anymore
+    graph.AddNode(5, QStringLiteral("Block 1"), 50, QStringLiteral("E"));
+    graph.AddDependency(5, 3);
+
+    QCOMPARE(graph.Count(), 6);
+    QCOMPARE(graph.Signature(5), 50U);
+    QCOMPARE(graph.Dependencies(5), QVector<quint32>() << 3);
+    QCOMPARE(graph.Dependents(QVector<quint32>() << 2), QVector<quint32>() << 2 << 4 << 6);
+    QCOMPARE(graph.Dependents(QVector<quint32>() << 3), QVector<quint32>() << 3 << 5);
+}
@@ -74,13 +74,13 @@ void TST_VMeasurements::CreateEmptyMultisizeFile()
     const int size = 50;
 
     QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit));
-    VContainer::SetHeight(height);
-    VContainer::SetSize(size);
+    data->SetHeight(height);
+    data->SetSize(size);
 
     QSharedPointer<VMeasurements> m =
             QSharedPointer<VMeasurements>(new VMeasurements(mUnit, size, height, data.data()));
-    m->SetSize(VContainer::rsize());
-    m->SetHeight(VContainer::rheight());
+    m->SetSize(data->rsize());
+    m->SetHeight(data->rheight());
 
     QTemporaryFile file;
     QString fileName;
@@ -164,13 +164,13 @@ void TST_VMeasurements::ValidPMCodesMultisizeFile()
     const int size = 50;
 
     QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit));
-    VContainer::SetHeight(height);
-    VContainer::SetSize(size);
+    data->SetHeight(height);
+    data->SetSize(size);
 
     QSharedPointer<VMeasurements> m =
             QSharedPointer<VMeasurements>(new VMeasurements(mUnit, size, height, data.data()));
-    m->SetSize(VContainer::rsize());
-    m->SetHeight(VContainer::rheight());
+    m->SetSize(data->rsize());
+    m->SetHeight(data->rheight());
 
     const QStringList listSystems = ListPMSystems();
     for (int i = 0; i < listSystems.size(); ++i)
@@ -0,0 +1,207 @@
+/**************************************************************************
+ **
+ **  @file   tst_vpattern.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vpattern.h"
+#include "../../app/seamly2d/xml/vpattern.h"
+#include "../ifc/exception/vexception.h"
+#include "../ifc/ifcdef.h"
+#include "../ifc/xml/vpatternconverter.h"
+#include "../vgeometry/vpointf.h"
+#include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vsettings.h"
+#include "../vtools/tools/vdatatool.h"
+#include "../vwidgets/vmaingraphicsscene.h"
+#include "../vwidgets/vmaingraphicsview.h"
+
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+namespace
+{
+// Tools of tst_seamly2d/incremental_parse.val have ids from 1 to toolsCount
+const quint32 toolsCount = 11;
+
+//---------------------------------------------------------------------------------------------------------------------
+QHash<quint32, QPointF> Points(const VContainer &data)
+{
+    QHash<quint32, QPointF> points;
+    const QHash<quint32, QSharedPointer<VGObject> > *objects = data.DataGObjects();
+    for (auto i = objects->constBegin(); i != objects->constEnd(); ++i)
+    {
+        if (i.value()->getType() == GOType::Point)
+        {
+            points.insert(i.key(), static_cast<QPointF>(*i.value().staticCast<VPointF>()));
+        }
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QHash<QString, qreal> Variables(const VContainer &data)
+{
+    QHash<QString, qreal> values;
+    const QHash<QString, QSharedPointer<VInternalVariable> > *variables = data.DataVariables();
+    for (auto i = variables->constBegin(); i != variables->constEnd(); ++i)
+    {
+        values.insert(i.key(), i.value()->GetValue());
+    }
+    return values;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QHash<quint32, QPointF>> ToolsPoints(const VAbstractPattern &doc)
+{
+    QVector<QHash<quint32, QPointF>> points;
+    for (quint32 id = 1; id <= toolsCount; ++id)
+    {
+        points.append(Points(doc.getTool(id)->getData()));
+    }
+    return points;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPattern::TST_VPattern(QObject *parent)
+    : QObject(parent),
+      m_incrementalParse(false)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPattern::initTestCase()
+{
+    VSettings *settings = qobject_cast<VSettings *>(qApp->Settings());
+    QVERIFY(settings != nullptr);
+    m_incrementalParse = settings->IsIncrementalParse();
+    settings->SetIncrementalParse(true);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IncrementalParse check that recalculation of only dependent tools gives the same pattern as lite parse.
+ */
+void TST_VPattern::IncrementalParse()
+{
+    // Converter keeps a reserve copy of an old file next to it
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.path() + QLatin1String("/incremental_parse.val");
+    QVERIFY(QFile::copy(QFINDTESTDATA("tst_seamly2d/incremental_parse.val"), fileName));
+
+    qApp->setPatternUnit(Unit::Cm);
+    VContainer data(nullptr, qApp->patternUnitP());
+    Draw mode = Draw::Calculation;
+    VMainGraphicsScene draftScene;
+    VMainGraphicsScene pieceScene;
+    VMainGraphicsView view;
+    view.setScene(&draftScene);
+    qApp->setSceneView(&view);
+
+    VPattern doc(&data, &mode, &draftScene, &pieceScene);
+    try
+    {
+        VPatternConverter converter(fileName);
+        doc.setXMLContent(converter.Convert());
+        doc.Parse(Document::FullParse);
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+
+    QSignalSpy partial(&doc, &VAbstractPattern::PartialUpdateFromFile);
+    QSignalSpy full(&doc, &VAbstractPattern::FullUpdateFromFile);
+
+    struct Edit
+    {
+        quint32 id;
+        QString attribute;
+        QString value;
+        QVector<quint32> updated;
+    };
+
+    // Moving the base point changes the whole pattern, length of A4 only A4 and the arc around it.
+    const QVector<Edit> edits = QVector<Edit>()
+            << Edit{1, AttrX, QStringLiteral("12"), QVector<quint32>() << 1 << 2 << 3 << 4 << 5 << 6 << 7 << 8 << 9
+                                                                      << 10 << 11}
+            << Edit{6, AttrLength, QStringLiteral("6"), QVector<quint32>() << 6 << 7};
+
+    for (int i = 0; i < edits.size(); ++i)
+    {
+        const Edit &edit = edits.at(i);
+        QDomElement domElement = doc.elementById(edit.id);
+        doc.SetAttribute(domElement, edit.attribute, edit.value);
+
+        doc.LiteParseTree(Document::IncrementalParse);
+        QCOMPARE(full.count(), i);
+        QCOMPARE(partial.count(), 1);
+        QCOMPARE(partial.takeFirst().at(0).value<QVector<quint32>>(), edit.updated);
+
+        doc.setCurrentData();
+        const QHash<quint32, QPointF> points = Points(data);
+        const QHash<QString, qreal> variables = Variables(data);
+        const QVector<QHash<quint32, QPointF>> toolsPoints = ToolsPoints(doc);
+
+        doc.LiteParseTree(Document::LiteParse);
+        QCOMPARE(full.count(), i + 1);
+
+        QCOMPARE(points, Points(data));
+        QCOMPARE(variables, Variables(data));
+        QCOMPARE(toolsPoints, ToolsPoints(doc));
+    }
+
+    // Preview of dragging uses the dependency graph even when incremental parse is switched off
+    VSettings *settings = qobject_cast<VSettings *>(qApp->Settings());
+    settings->SetIncrementalParse(false);
+    QDomElement domElement = doc.elementById(6);
+    doc.SetAttribute(domElement, AttrLength, QStringLiteral("5"));
+    doc.LiteParseTree(Document::PreviewParse);
+    QCOMPARE(full.count(), edits.size());
+    QCOMPARE(partial.count(), 1);
+    QCOMPARE(partial.takeFirst().at(0).value<QVector<quint32>>(), QVector<quint32>() << 6 << 7);
+    settings->SetIncrementalParse(true);
+
+    // A new name means new variables, only lite parse can handle it
+    doc.SetAttribute(domElement, AttrName, QStringLiteral("A5"));
+    doc.LiteParseTree(Document::IncrementalParse);
+    QCOMPARE(partial.count(), 0);
+    QCOMPARE(full.count(), edits.size() + 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPattern::cleanupTestCase()
+{
+    qApp->setSceneView(nullptr);
+
+    VSettings *settings = qobject_cast<VSettings *>(qApp->Settings());
+    if (settings != nullptr)
+    {
+        settings->SetIncrementalParse(m_incrementalParse);
+    }
+}
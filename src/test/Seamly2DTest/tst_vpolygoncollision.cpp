@@ -0,0 +1,166 @@
+/**************************************************************************
+ **
+ **  @file   tst_vpolygoncollision.cpp
+ **  @author Seamly2D project
+ **  @date   10 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly2D project.
+ **  This source code is part of the Seamly2D project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **
+ **  <https://github.com/fashionfreedom/seamly2d> All Rights Reserved.
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published
+ **  by the Free Software Foundation, either version 3 of the License,
+ **  or (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vpolygoncollision.h"
+#include "../vlayout/vpolygoncollision.h"
+#include "../vlayout/vsegmentgrid.h"
+
+#include <QPainterPath>
+#include <QtMath>
+#include <QtTest>
+#include <algorithm>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Square(qreal x, qreal y, qreal size)
+{
+    QVector<QPointF> points;
+    points << QPointF(x, y) << QPointF(x + size, y) << QPointF(x + size, y + size) << QPointF(x, y + size);
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPainterPath ClosedPath(const QVector<QPointF> &points)
+{
+    QPainterPath path;
+    path.setFillRule(Qt::WindingFill);
+    path.moveTo(points.at(0));
+    for (int i = 1; i < points.count(); ++i)
+    {
+        path.lineTo(points.at(i));
+    }
+    path.lineTo(points.at(0));
+    return path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Star(const QPointF &center, qreal radius, int rays)
+{
+    QVector<QPointF> points;
+    for (int i = 0; i < rays * 2; ++i)
+    {
+        const qreal r = i % 2 == 0 ? radius : radius / 3;
+        const qreal angle = M_PI * i / rays;
+        points << QPointF(center.x() + r * qCos(angle), center.y() + r * qSin(angle));
+    }
+    return points;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPolygonCollision::TST_VPolygonCollision(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonCollision::PolygonsIntersect_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("polygon1");
+    QTest::addColumn<QVector<QPointF>>("polygon2");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Disjoint") << Square(0, 0, 10) << Square(20, 20, 10) << false;
+    QTest::newRow("Bounding rects overlap") << QVector<QPointF>({QPointF(0, 0), QPointF(10, 0), QPointF(0, 10)})
+                                            << QVector<QPointF>({QPointF(10, 10), QPointF(10, 6), QPointF(6, 10)})
+                                            << false;
+    QTest::newRow("Crossing edges") << Square(0, 0, 10) << Square(5, 5, 10) << true;
+    QTest::newRow("Common edge") << Square(0, 0, 10) << Square(10, 0, 10) << true;
+    QTest::newRow("Common vertex") << Square(0, 0, 10) << Square(10, 10, 10) << true;
+    QTest::newRow("Second inside first") << Square(0, 0, 100) << Square(10, 10, 10) << true;
+    QTest::newRow("First inside second") << Square(10, 10, 10) << Square(0, 0, 100) << true;
+
+    QVector<QPointF> cShape;
+    cShape << QPointF(0, 0) << QPointF(30, 0) << QPointF(30, 10) << QPointF(10, 10) << QPointF(10, 20)
+           << QPointF(30, 20) << QPointF(30, 30) << QPointF(0, 30);
+    QTest::newRow("Inside concave notch") << cShape << Square(15, 12, 5) << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonCollision::PolygonsIntersect() const
+{
+    QFETCH(QVector<QPointF>, polygon1);
+    QFETCH(QVector<QPointF>, polygon2);
+    QFETCH(bool, expectedResult);
+
+    QCOMPARE(VPolygonCollision::PolygonsIntersect(polygon1, polygon2), expectedResult);
+    QCOMPARE(VPolygonCollision::PolygonsIntersect(polygon2, polygon1), expectedResult);
+
+    // Must give the same verdict as QPainterPath used by layout before
+    QCOMPARE(ClosedPath(polygon1).intersects(ClosedPath(polygon2)), expectedResult);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonCollision::PolygonContains_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("polygon");
+    QTest::addColumn<QPointF>("point");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Inside") << Square(0, 0, 10) << QPointF(5, 5) << true;
+    QTest::newRow("Outside") << Square(0, 0, 10) << QPointF(15, 5) << false;
+
+    QVector<QPointF> reversed = Square(0, 0, 10);
+    std::reverse(reversed.begin(), reversed.end());
+    QTest::newRow("Inside, reversed direction") << reversed << QPointF(5, 5) << true;
+
+    QVector<QPointF> star;
+    star << QPointF(50, 0) << QPointF(79, 90) << QPointF(2, 35) << QPointF(98, 35) << QPointF(21, 90);
+    QTest::newRow("Self-intersecting, center") << star << QPointF(50, 50) << true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonCollision::PolygonContains() const
+{
+    QFETCH(QVector<QPointF>, polygon);
+    QFETCH(QPointF, point);
+    QFETCH(bool, expectedResult);
+
+    QCOMPARE(VPolygonCollision::PolygonContains(polygon, point), expectedResult);
+    QCOMPARE(ClosedPath(polygon).contains(point), expectedResult);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonCollision::GridMatchesLinearSearch() const
+{
+    const QVector<QPointF> contour = Star(QPointF(500, 500), 400, 100);
+    const VSegmentGrid grid(contour);
+
+    for (int x = 0; x <= 1000; x += 25)
+    {
+        for (int y = 0; y <= 1000; y += 25)
+        {
+            const QVector<QPointF> piece = Square(x, y, 20);
+            QCOMPARE(VPolygonCollision::PolygonsIntersect(contour, grid, piece),
+                     VPolygonCollision::PolygonsIntersect(contour, piece));
+            QCOMPARE(VPolygonCollision::PolygonContains(contour, grid, QPointF(x, y)),
+                     VPolygonCollision::PolygonContains(contour, QPointF(x, y)));
+        }
+    }
+}
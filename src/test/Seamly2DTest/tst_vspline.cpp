@@ -454,6 +454,56 @@ void TST_VSpline::TestFlip()
     QCOMPARE(spl.GetC2Length(), res.GetC2Length());
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestLengthCache()
+{
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+
+    VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+    const qreal length = spl.GetLength();
+    QCOMPARE(length, VAbstractCurve::PathLength(spl.GetPoints()));
+
+    // Copy shares cached points until it changes
+    VSpline copy = spl;
+    const VPointF newP4(681.33729132409951, 1000, "p4", 5.0000125984251973, 9.9999874015748045);
+    copy.SetP4(newP4);
+
+    const VSpline expected(copy.GetP1(), static_cast<QPointF>(copy.GetP2()), static_cast<QPointF>(copy.GetP3()),
+                           copy.GetP4());
+    QVERIFY(qAbs(copy.GetLength() - expected.GetLength()) < ToPixel(0.5, Unit::Mm));
+    QVERIFY(qAbs(copy.GetLengthByPoint(newP4.toQPointF()) - expected.GetLength()) < ToPixel(0.5, Unit::Mm));
+    QCOMPARE(spl.GetLength(), length);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestParamAtLength()
+{
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+
+    VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+
+    const qreal fullLength = spl.LengthAtParam(1);
+    QVERIFY(qAbs(fullLength - spl.GetLength()) < ToPixel(0.5, Unit::Mm));
+
+    QCOMPARE(spl.ParamAtLength(-1), 0.0);
+    QCOMPARE(spl.ParamAtLength(fullLength + 1), 1.0);
+
+    for (int i = 1; i < 10; ++i)
+    {
+        const qreal length = fullLength * i / 10.0;
+        const qreal t = spl.ParamAtLength(length);
+        QVERIFY(qAbs(spl.LengthAtParam(t) - length) < fullLength * 1e-6);
+        QVERIFY(qAbs(spl.LengthT(t) - length) < ToPixel(0.5, Unit::Mm));
+    }
+
+    // Evenly spaced control points of a straight line give uniform parameterization
+    const VSpline line(VPointF(0, 0, "p1", 0, 0), QPointF(100, 0), QPointF(200, 0), VPointF(300, 0, "p4", 0, 0));
+    QVERIFY(qAbs(line.LengthAtParam(1) - 300) < 1e-6);
+    QVERIFY(qAbs(line.ParamAtLength(150) - 0.5) < 1e-6);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VSpline::CompareSplines(const VSpline &spl1, const VSpline &spl2) const
 {
@@ -76,6 +76,8 @@ private slots:
     void TestLengthByPoint();
     void TestFlip_data();
     void TestFlip();
+    void TestLengthCache();
+    void TestParamAtLength();
 
 private:
     Q_DISABLE_COPY(TST_VSpline)